@@ -0,0 +1,666 @@
+//-----------------------------------------------------------------------------
+// File:		graphbench.cpp
+// Programmer:	Anthony Waddell
+// Resources:	https://en.wikipedia.org/wiki/Barab%C3%A1si%E2%80%93Albert_model
+//				http://man7.org/linux/man-pages/man2/getrusage.2.html
+//
+// Benchmark driver for GraphM and GraphL, kept out of the top directory so
+// lab3 still builds from *.cpp there. Build from the top directory with
+// every .cpp but lab3.cpp, for instance
+//		g++ -O2 -pthread -I. bench/graphbench.cpp $(ls *.cpp | grep -v lab3)
+//			-o graphbench
+// Usage:
+//		graphbench [-type random|grid|scalefree|complete|all] [-nodes V]
+//			[-edges E] [-seed S] [-sources K] [-queries Q]
+//			[-allpairs-limit N] [-threads T] [-landmarks L]
+//			[-hierarchy 0|1] [-delta D] [-file name]
+// Phases that fill the table are left out for graphs of more than N nodes.
+// The tree phases time the same sources without the table, sequential and
+// with delta stepping of bucket width D, 0 choosing it from the edges.
+// The contraction hierarchy is only timed with -hierarchy 1, and never on
+// the complete graph, where every contraction adds a shortcut between almost
+// every pair of remaining nodes.
+// Each graph is generated from the seed alone, so runs with the same
+// arguments time the same graphs. Every phase prints one JSON line:
+//		{"graph":"grid","nodes":V,"edges":E,"phase":"parse","seconds":t,
+//		 "edges_per_sec":r,"queries_per_sec":q,"peak_rss_kb":m}
+// queries_per_sec is 0 for phases without queries. Peak RSS is the high
+// water mark of the process so far, so run one graph type per process to
+// compare memory between types
+//-----------------------------------------------------------------------------
+#include "graphl.h"
+#include "graphm.h"
+#include "graphparser.h"
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+using namespace std;
+
+// Settings from the command line
+struct BenchOptions
+{
+	string type;               // graph kind, or "all"
+	int nodes;                 // nodes to generate
+	long long edges;           // edges to generate, where the kind allows
+	unsigned seed;             // generator seed
+	int sources;               // single source searches to time
+	int queries;               // point to point queries to time
+	int allPairsLimit;         // most nodes all pairs is timed for
+	int threads;               // all pairs threads, 0 for one per core
+	int landmarks;             // landmarks of A* queries, 0 for none
+	bool hierarchy;            // time the contraction hierarchy
+	int delta;                 // delta stepping bucket width, 0 for auto
+	string file;               // scratch file for the generated graph
+};
+
+// One generated graph
+struct BenchGraph
+{
+	string type;               // graph kind
+	int nodes;                 // number of nodes
+	vector<EdgeRecord> edges;  // edges with weights from 1 to 100
+};
+
+//-----------------------------------------------------------------------------
+// Function:	static long peakRssKb()
+// Title:		Peak resident memory
+// Description: Returns the most resident memory the process has used
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		long; peak resident set size in KB, 0 if not known
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+static long peakRssKb()
+{
+#ifdef _WIN32
+	PROCESS_MEMORY_COUNTERS counters;
+	if (GetProcessMemoryInfo(GetCurrentProcess(), &counters,
+		sizeof(counters)))
+	{
+		return (long)(counters.PeakWorkingSetSize / 1024);
+	}
+	return 0;
+#else
+	struct rusage usage;
+	if (getrusage(RUSAGE_SELF, &usage) != 0)
+	{
+		return 0;
+	}
+#ifdef __APPLE__
+	return (long)(usage.ru_maxrss / 1024);
+#else
+	return (long)usage.ru_maxrss;
+#endif
+#endif
+}
+
+//-----------------------------------------------------------------------------
+// Function:	static double secondsSince(
+//					chrono::steady_clock::time_point start)
+// Title:		Elapsed time
+// Description: Returns the seconds from start to now
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	chrono::steady_clock::time_point start; start of the phase
+// Returns:		double; elapsed seconds
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+static double secondsSince(chrono::steady_clock::time_point start)
+{
+	return chrono::duration<double>(chrono::steady_clock::now()
+		- start).count();
+}
+
+//-----------------------------------------------------------------------------
+// Function:	static void report(const BenchGraph &graph,
+//					const string &phase, double seconds, double edges,
+//					double queries)
+// Title:		Prints one result
+// Description: Prints the timing of one phase as a JSON line, with the
+//					edges and queries it handled turned into rates
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	const BenchGraph &graph; graph the phase ran on
+//				const string &phase; name of the phase
+//				double seconds; time the phase took
+//				double edges; edges the phase handled
+//				double queries; queries the phase answered, 0 if none
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+static void report(const BenchGraph &graph, const string &phase,
+	double seconds, double edges, double queries)
+{
+	double time = seconds > 0 ? seconds : 1e-9;
+	printf("{\"graph\":\"%s\",\"nodes\":%d,\"edges\":%lld,\"phase\":\"%s\","
+		"\"seconds\":%.6f,\"edges_per_sec\":%.0f,\"queries_per_sec\":%.0f,"
+		"\"peak_rss_kb\":%ld}\n", graph.type.c_str(), graph.nodes,
+		(long long)graph.edges.size(), phase.c_str(), seconds, edges / time,
+		queries / time, peakRssKb());
+	fflush(stdout);
+}
+
+//-----------------------------------------------------------------------------
+// Function:	static void addEdge(BenchGraph &graph, int source,
+//					int destination, mt19937 &random)
+// Title:		Adds a generated edge
+// Description: Appends an edge with a weight from 1 to 100. Weights are
+//					taken from the raw generator output, since the standard
+//					distributions may differ between libraries
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	BenchGraph &graph; graph being generated
+//				int source; node the edge leaves
+//				int destination; node the edge enters
+//				mt19937 &random; generator
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+static void addEdge(BenchGraph &graph, int source, int destination,
+	mt19937 &random)
+{
+	EdgeRecord edge;
+	edge.source = source;
+	edge.destination = destination;
+	edge.weight = 1 + (int)(random() % 100);
+	graph.edges.push_back(edge);
+}
+
+//-----------------------------------------------------------------------------
+// Function:	static BenchGraph generate(const string &type, int nodes,
+//					long long edges, unsigned seed)
+// Title:		Generates a graph
+// Description: Generates one of
+//					random		edges between uniformly chosen nodes
+//					grid		a square grid of nodes joined both ways to
+//								their neighbours, like a road map, edges
+//								ignored
+//					scalefree	preferential attachment, each new node
+//								joined both ways to nodes chosen in
+//								proportion to their degree
+//					complete	an edge between every ordered pair, edges
+//								ignored
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	const string &type; kind of graph
+//				int nodes; number of nodes
+//				long long edges; number of edges wanted
+//				unsigned seed; generator seed
+// Returns:		BenchGraph; the graph, no nodes if type is unknown
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+static BenchGraph generate(const string &type, int nodes, long long edges,
+	unsigned seed)
+{
+	BenchGraph graph;
+	graph.type = type;
+	graph.nodes = max(nodes, 2);
+	mt19937 random(seed);
+
+	if (type == "random")
+	{
+		graph.edges.reserve((size_t)edges);
+		for (long long e = 0; e < edges; e++)
+		{
+			int source = 1 + (int)(random() % graph.nodes);
+			int destination = 1 + (int)(random() % graph.nodes);
+			if (source != destination)
+			{
+				addEdge(graph, source, destination, random);
+			}
+		}
+	}
+	else if (type == "grid")
+	{
+		int side = 1;
+		while ((side + 1) * (side + 1) <= graph.nodes)
+		{
+			side++;
+		}
+		graph.nodes = side * side;
+		for (int row = 0; row < side; row++)
+		{
+			for (int column = 0; column < side; column++)
+			{
+				int node = row * side + column + 1;
+				if (column + 1 < side)
+				{
+					addEdge(graph, node, node + 1, random);
+					addEdge(graph, node + 1, node, random);
+				}
+				if (row + 1 < side)
+				{
+					addEdge(graph, node, node + side, random);
+					addEdge(graph, node + side, node, random);
+				}
+			}
+		}
+	}
+	else if (type == "scalefree")
+	{
+		// Each node appears in ends once per edge it has
+		int links = (int)max(edges / (2LL * graph.nodes), 1LL);
+		vector<int> ends;
+		ends.push_back(1);
+		for (int node = 2; node <= graph.nodes; node++)
+		{
+			for (int i = 0; i < links && i < node - 1; i++)
+			{
+				int other = ends[random() % ends.size()];
+				addEdge(graph, node, other, random);
+				addEdge(graph, other, node, random);
+				ends.push_back(other);
+				ends.push_back(node);
+			}
+		}
+	}
+	else if (type == "complete")
+	{
+		graph.edges.reserve((size_t)graph.nodes * (graph.nodes - 1));
+		for (int source = 1; source <= graph.nodes; source++)
+		{
+			for (int destination = 1; destination <= graph.nodes;
+				destination++)
+			{
+				if (source != destination)
+				{
+					addEdge(graph, source, destination, random);
+				}
+			}
+		}
+	}
+	else
+	{
+		graph.nodes = 0;
+	}
+	return graph;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	static bool writeGraph(const BenchGraph &graph,
+//					const string &fileName, bool weighted)
+// Title:		Writes a graph data file
+// Description: Writes graph in the text format buildGraph reads, with a
+//					weight on each edge for GraphM and without for GraphL
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	const BenchGraph &graph; graph to write
+//				const string &fileName; file to create or replace
+//				bool weighted; write edge weights
+// Returns:		bool; true if the file was written
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+static bool writeGraph(const BenchGraph &graph, const string &fileName,
+	bool weighted)
+{
+	FILE *out = fopen(fileName.c_str(), "wb");
+	if (out == NULL)
+	{
+		return false;
+	}
+	fprintf(out, "%d\n", graph.nodes);
+	for (int i = 1; i <= graph.nodes; i++)
+	{
+		fprintf(out, "node %d\n", i);
+	}
+	for (size_t e = 0; e < graph.edges.size(); e++)
+	{
+		const EdgeRecord &edge = graph.edges[e];
+		if (weighted)
+		{
+			fprintf(out, "%d %d %d\n", edge.source, edge.destination,
+				edge.weight);
+		}
+		else
+		{
+			fprintf(out, "%d %d\n", edge.source, edge.destination);
+		}
+	}
+	fprintf(out, weighted ? "0 0 0\n" : "0 0\n");
+	return fclose(out) == 0;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	static void timeQueries(const BenchGraph &graph,
+//					const BenchOptions &options, GraphM &paths,
+//					const string &phase)
+// Title:		Times point to point queries
+// Description: Times the queries between random pairs of nodes, the same
+//					pairs on every call for the same seed
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	const BenchGraph &graph; graph paths was built from
+//				const BenchOptions &options; number of queries and seed
+//				GraphM &paths; graph to query
+//				const string &phase; name to report the time under
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+static void timeQueries(const BenchGraph &graph, const BenchOptions &options,
+	GraphM &paths, const string &phase)
+{
+	if (options.queries <= 0)
+	{
+		return;
+	}
+	mt19937 random(options.seed + 1);
+	vector<int> nodes;
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+	for (int i = 0; i < options.queries; i++)
+	{
+		int source = 1 + (int)(random() % graph.nodes);
+		int destination = 1 + (int)(random() % graph.nodes);
+		paths.query(source, destination, nodes);
+	}
+	report(graph, phase, secondsSince(start), 0, options.queries);
+}
+
+//-----------------------------------------------------------------------------
+// Function:	static void benchGraph(const BenchGraph &graph,
+//					const BenchOptions &options)
+// Title:		Times every phase on one graph
+// Description: Times, in order, parsing the data file alone, buildGraph,
+//					single source searches from evenly spread sources,
+//					the same searches without the table, sequential then
+//					with delta stepping,
+//					point to point queries between random pairs, building
+//					landmarks and the same queries with them, building a
+//					contraction hierarchy if asked, except on the complete
+//					graph, and the same queries over it, all pairs,
+//					and GraphL buildGraph and depth first ordering from
+//					node 1. The single source and all pairs phases fill the
+//					V^2 table, so they only run when the graph has at most
+//					the all pairs limit of nodes
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	const BenchGraph &graph; graph to time
+//				const BenchOptions &options; counts and limits
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Times landmark queries
+//				10/17/26 AW Times contraction hierarchy queries
+//				10/17/26 AW Times delta stepping trees
+//				10/17/26 AW No hierarchy on the complete graph
+//-----------------------------------------------------------------------------
+static void benchGraph(const BenchGraph &graph, const BenchOptions &options)
+{
+	double edges = (double)graph.edges.size();
+	if (!writeGraph(graph, options.file, true))
+	{
+		cerr << "cannot write " << options.file << endl;
+		return;
+	}
+
+	// Parsing alone
+	{
+		ifstream in(options.file.c_str(), ios::binary);
+		int nodes = 0;
+		NameTable names;
+		vector<EdgeRecord> records;
+		chrono::steady_clock::time_point start = chrono::steady_clock::now();
+		GraphParser parser(in);
+		parser.readGraph(3, nodes, names, records);
+		report(graph, "parse", secondsSince(start), edges, 0);
+	}
+
+	// Parse and build of the packed graph
+	GraphM paths;
+	paths.setThreads(options.threads);
+	{
+		ifstream in(options.file.c_str(), ios::binary);
+		chrono::steady_clock::time_point start = chrono::steady_clock::now();
+		paths.buildGraph(in);
+		report(graph, "build", secondsSince(start), edges, 0);
+	}
+
+	// Single source searches, each a full row of the table
+	int sources = min(options.sources, graph.nodes);
+	if (sources > 0 && graph.nodes <= options.allPairsLimit)
+	{
+		chrono::steady_clock::time_point start = chrono::steady_clock::now();
+		for (int i = 0; i < sources; i++)
+		{
+			paths.shortestFrom(1 + (int)((long long)i * graph.nodes / sources));
+		}
+		report(graph, "single_source", secondsSince(start),
+			edges * sources, sources);
+	}
+
+	// The same sources into vectors, then shared between threads
+	if (sources > 0)
+	{
+		vector<int> dist;
+		vector<int> path;
+		GraphM::AllPairsMethod methods[2] = { GraphM::SPARSE_DIJKSTRA,
+			GraphM::DELTA_STEPPING };
+		const char *phases[2] = { "tree", "delta_tree" };
+		paths.setDelta(options.delta);
+		for (int m = 0; m < 2; m++)
+		{
+			paths.setAllPairsMethod(methods[m]);
+			chrono::steady_clock::time_point start =
+				chrono::steady_clock::now();
+			for (int i = 0; i < sources; i++)
+			{
+				paths.shortestTree(
+					1 + (int)((long long)i * graph.nodes / sources),
+					dist, path);
+			}
+			report(graph, phases[m], secondsSince(start),
+				edges * sources, sources);
+		}
+		paths.setAllPairsMethod(GraphM::SPARSE_DIJKSTRA);
+	}
+
+	// Point to point queries between random pairs, then the same pairs
+	// with A* over landmark bounds
+	timeQueries(graph, options, paths, "query");
+	if (options.landmarks > 0 && options.queries > 0)
+	{
+		chrono::steady_clock::time_point start = chrono::steady_clock::now();
+		paths.buildLandmarks(options.landmarks);
+		report(graph, "landmark_build", secondsSince(start),
+			2.0 * edges * options.landmarks, 0);
+		timeQueries(graph, options, paths, "landmark_query");
+		paths.buildLandmarks(0);
+	}
+	if (options.hierarchy && options.queries > 0 && graph.type != "complete")
+	{
+		chrono::steady_clock::time_point start = chrono::steady_clock::now();
+		paths.buildHierarchy();
+		report(graph, "hierarchy_build", secondsSince(start), edges, 0);
+		timeQueries(graph, options, paths, "hierarchy_query");
+		paths.dropHierarchy();
+	}
+
+	// All pairs, one row per source
+	if (graph.nodes <= options.allPairsLimit)
+	{
+		paths.setAllPairsMethod(GraphM::AUTO_METHOD);
+		chrono::steady_clock::time_point start = chrono::steady_clock::now();
+		paths.findShortestPath();
+		report(graph, "all_pairs", secondsSince(start),
+			edges * graph.nodes, graph.nodes);
+	}
+
+	// Depth first ordering over the unweighted edges
+	if (!writeGraph(graph, options.file, false))
+	{
+		cerr << "cannot write " << options.file << endl;
+		return;
+	}
+	GraphL order;
+	{
+		ifstream in(options.file.c_str(), ios::binary);
+		chrono::steady_clock::time_point start = chrono::steady_clock::now();
+		order.buildGraph(in);
+		report(graph, "dfs_build", secondsSince(start), edges, 0);
+	}
+	{
+		vector<int> visited;
+		chrono::steady_clock::time_point start = chrono::steady_clock::now();
+		order.depthFirstOrder(1, visited);
+		report(graph, "dfs", secondsSince(start), edges, 0);
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Function:	static bool readOptions(int argc, char **argv,
+//					BenchOptions &options)
+// Title:		Reads the command line
+// Description: Sets options from -name value pairs, leaving defaults for
+//					those not given
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int argc; number of arguments
+//				char **argv; arguments
+//				BenchOptions &options; set to the settings
+// Returns:		bool; false if an argument was not understood
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Reads -landmarks
+//				10/17/26 AW Reads -hierarchy
+//				10/17/26 AW Reads -delta
+//-----------------------------------------------------------------------------
+static bool readOptions(int argc, char **argv, BenchOptions &options)
+{
+	options.type = "all";
+	options.nodes = 2000;
+	options.edges = -1;
+	options.seed = 1;
+	options.sources = 100;
+	options.queries = 1000;
+	options.allPairsLimit = 2000;
+	options.threads = 0;
+	options.landmarks = 16;
+	options.hierarchy = false;
+	options.delta = 0;
+	options.file = "graphbench.tmp";
+
+	for (int i = 1; i + 1 < argc; i += 2)
+	{
+		string name = argv[i];
+		const char *value = argv[i + 1];
+		if (name == "-type")
+		{
+			options.type = value;
+		}
+		else if (name == "-nodes")
+		{
+			options.nodes = atoi(value);
+		}
+		else if (name == "-edges")
+		{
+			options.edges = atoll(value);
+		}
+		else if (name == "-seed")
+		{
+			options.seed = (unsigned)strtoul(value, NULL, 10);
+		}
+		else if (name == "-sources")
+		{
+			options.sources = atoi(value);
+		}
+		else if (name == "-queries")
+		{
+			options.queries = atoi(value);
+		}
+		else if (name == "-allpairs-limit")
+		{
+			options.allPairsLimit = atoi(value);
+		}
+		else if (name == "-threads")
+		{
+			options.threads = atoi(value);
+		}
+		else if (name == "-landmarks")
+		{
+			options.landmarks = atoi(value);
+		}
+		else if (name == "-hierarchy")
+		{
+			options.hierarchy = atoi(value) != 0;
+		}
+		else if (name == "-delta")
+		{
+			options.delta = atoi(value);
+		}
+		else if (name == "-file")
+		{
+			options.file = value;
+		}
+		else
+		{
+			return false;
+		}
+	}
+	if (options.edges < 0)
+	{
+		options.edges = 8LL * options.nodes;
+	}
+	return argc % 2 == 1;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	int main(int argc, char **argv)
+// Title:		Benchmark driver
+// Description: Generates each graph asked for and times its phases
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int argc; number of arguments
+//				char **argv; arguments
+// Returns:		int; 0 on success, 1 for bad arguments
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Usage shows -landmarks
+//				10/17/26 AW Usage shows -hierarchy
+//				10/17/26 AW Usage shows -delta
+//-----------------------------------------------------------------------------
+int main(int argc, char **argv)
+{
+	BenchOptions options;
+	if (!readOptions(argc, argv, options))
+	{
+		cerr << "usage: graphbench [-type random|grid|scalefree|complete|all]"
+			" [-nodes V] [-edges E] [-seed S] [-sources K] [-queries Q]"
+			" [-allpairs-limit N] [-threads T] [-landmarks L]"
+			" [-hierarchy 0|1] [-delta D] [-file name]" << endl;
+		return 1;
+	}
+
+	const char *types[4] = { "random", "grid", "scalefree", "complete" };
+	for (int i = 0; i < 4; i++)
+	{
+		if (options.type != "all" && options.type != types[i])
+		{
+			continue;
+		}
+		BenchGraph graph = generate(types[i], options.nodes, options.edges,
+			options.seed);
+		benchGraph(graph, options);
+	}
+	remove(options.file.c_str());
+	return 0;
+}
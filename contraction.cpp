@@ -0,0 +1,878 @@
+//-----------------------------------------------------------------------------
+// File:		contraction.cpp
+// Programmer:	Anthony Waddell
+// Resources:	Geisberger, Sanders, Schultes, Delling, Contraction
+//					Hierarchies: Faster and Simpler Hierarchical Routing in
+//					Road Networks, WEA 2008
+//					https://en.wikipedia.org/wiki/Contraction_hierarchies
+//-----------------------------------------------------------------------------
+#include "contraction.h"
+#include <algorithm>
+#include <string.h>
+
+//-----------------------------------------------------------------------------
+// Function:	ContractionHierarchy::ContractionHierarchy()
+// Title:		Constructor
+// Description: Constructs an empty hierarchy, built by build
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		N/A
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+ContractionHierarchy::ContractionHierarchy()
+{
+	nodes = 0;
+	shortcuts = 0;
+	clearCounters();
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void ContractionHierarchy::build(const CSRGraph &graph)
+// Title:		Builds the hierarchy
+// Description: Copies the edges of graph, keeping the cheapest of parallel
+//					edges, then contracts the node of lowest priority until
+//					none are left. Priorities are kept lazily: contracting
+//					a node marks its neighbours stale, and a stale node on
+//					top of the queue has its priority found again and is
+//					queued again if it is no longer the lowest. A node's
+//					remaining edges when it is contracted all lead to nodes
+//					contracted later, so they become its up and down arcs
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	const CSRGraph &graph; edges of each node
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Priorities found again only when stale, parallel
+//					edges merged through arcSlot
+//-----------------------------------------------------------------------------
+void ContractionHierarchy::build(const CSRGraph &graph)
+{
+	clear();
+	nodes = graph.nodeCount();
+	if (nodes < 1)
+	{
+		nodes = 0;
+		return;
+	}
+
+	const int *offsets = graph.offsetArray();
+	const int *targets = graph.targetArray();
+	const int *weights = graph.weightArray();
+	outArcs.assign(nodes + 1, vector<Arc>());
+	inArcs.assign(nodes + 1, vector<Arc>());
+	arcSlot.assign(nodes + 1, -1);
+	for (int u = 1; u <= nodes; u++)
+	{
+		batch.clear();
+		for (int e = offsets[u]; e < offsets[u + 1]; e++)
+		{
+			if (weights[e] != INT_MAX && targets[e] != u)
+			{
+				EdgeRecord edge;
+				edge.source = u;
+				edge.destination = targets[e];
+				edge.weight = weights[e];
+				batch.push_back(edge);
+			}
+		}
+		mergeArcs(outArcs[u], 0, batch.size(), true, 0);
+		for (size_t i = 0; i < outArcs[u].size(); i++)
+		{
+			Arc arc = outArcs[u][i];
+			arc.node = u;
+			inArcs[outArcs[u][i].node].push_back(arc);
+		}
+	}
+	neighboursGone.assign(nodes + 1, 0);
+	witnessDist.assign(nodes + 1, INT_MAX);
+	witnessHops.assign(nodes + 1, 0);
+	witnessGoal.assign(nodes + 1, 0);
+	vector<uint8_t> stale(nodes + 1, 0);
+
+	BinaryHeap queue;
+	for (int v = 1; v <= nodes; v++)
+	{
+		queue.push(priority(v), v);
+	}
+	int key = 0;
+	int v = 0;
+	while (queue.pop(key, v))
+	{
+		if (stale[v])
+		{
+			stale[v] = 0;
+			int current = priority(v);
+			if (!queue.empty() && current > queue.topKey())
+			{
+				queue.push(current, v);
+				continue;
+			}
+		}
+		shortcuts += contract(v, true);
+
+		// The remaining neighbours lose their edges to v
+		for (size_t i = 0; i < inArcs[v].size(); i++)
+		{
+			int u = inArcs[v][i].node;
+			removeArc(outArcs[u], v);
+			neighboursGone[u]++;
+			stale[u] = 1;
+		}
+		for (size_t i = 0; i < outArcs[v].size(); i++)
+		{
+			int x = outArcs[v][i].node;
+			removeArc(inArcs[x], v);
+			neighboursGone[x]++;
+			stale[x] = 1;
+		}
+	}
+	pack();
+
+	// Only the packed arcs are needed from here on
+	vector<vector<Arc> >().swap(outArcs);
+	vector<vector<Arc> >().swap(inArcs);
+	vector<int>().swap(neighboursGone);
+	vector<int>().swap(witnessDist);
+	vector<int>().swap(witnessHops);
+	vector<int>().swap(witnessTouched);
+	vector<uint8_t>().swap(witnessGoal);
+	vector<int>().swap(arcSlot);
+	vector<EdgeRecord>().swap(batch);
+	witnessHeap.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Function:	int ContractionHierarchy::priority(int node)
+// Title:		Contraction priority
+// Description: Returns the edge difference of node, shortcuts its
+//					contraction would add less the edges it would remove,
+//					plus the number of its neighbours already contracted.
+//					Nodes whose removal simplifies the graph go first, and
+//					the second term spreads contraction evenly over it
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int node; node not yet contracted
+// Returns:		int; priority, lowest contracted first
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+int ContractionHierarchy::priority(int node)
+{
+	int added = contract(node, false);
+	int removed = (int)(inArcs[node].size() + outArcs[node].size());
+	return 2 * (added - removed) + neighboursGone[node];
+}
+
+//-----------------------------------------------------------------------------
+// Function:	int ContractionHierarchy::contract(int node, bool apply)
+// Title:		Contracts a node
+// Description: For each remaining edge u to node, searches from u around
+//					node for the other ends x of node's outgoing edges. When
+//					no path from u to x at most as cheap as going through
+//					node is found, a shortcut from u to x through node is
+//					needed. A search that gives up early adds a shortcut
+//					that may not be needed, which costs space but never
+//					gives a wrong answer. Counting for a priority uses a
+//					smaller search, since it is repeated whenever a
+//					neighbour is contracted. Shortcuts are collected and
+//					merged into the edges of each end at once, so adding
+//					one costs O(1) rather than a scan of the edges
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int node; node to contract
+//				bool apply; add the shortcuts, false to only count them
+// Returns:		int; number of shortcuts needed
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Hop limited searches that stop once every x is
+//					settled, shortcuts merged in a batch
+//-----------------------------------------------------------------------------
+int ContractionHierarchy::contract(int node, bool apply)
+{
+	const vector<Arc> &in = inArcs[node];
+	const vector<Arc> &out = outArcs[node];
+	int count = 0;
+	batch.clear();
+	for (size_t j = 0; j < out.size(); j++)
+	{
+		witnessGoal[out[j].node] = 1;
+	}
+	for (size_t i = 0; i < in.size(); i++)
+	{
+		int u = in[i].node;
+		long long limit = -1;
+		for (size_t j = 0; j < out.size(); j++)
+		{
+			if (out[j].node != u)
+			{
+				limit = max(limit, (long long)in[i].weight + out[j].weight);
+			}
+		}
+		if (limit < 0)
+		{
+			continue;
+		}
+		int goals = (int)out.size() - witnessGoal[u];
+		if (apply)
+		{
+			witnessSearch(u, node, limit, goals, WITNESS_LIMIT, WITNESS_HOPS);
+		}
+		else
+		{
+			witnessSearch(u, node, limit, goals, PRIORITY_LIMIT,
+				PRIORITY_HOPS);
+		}
+		for (size_t j = 0; j < out.size(); j++)
+		{
+			int x = out[j].node;
+			long long cost = (long long)in[i].weight + out[j].weight;
+			if (x == u || cost >= INT_MAX || witnessDist[x] <= cost)
+			{
+				continue;
+			}
+			count++;
+			if (apply)
+			{
+				EdgeRecord shortcut;
+				shortcut.source = u;
+				shortcut.destination = x;
+				shortcut.weight = (int)cost;
+				batch.push_back(shortcut);
+			}
+		}
+	}
+	for (size_t j = 0; j < out.size(); j++)
+	{
+		witnessGoal[out[j].node] = 0;
+	}
+	if (!apply || batch.empty())
+	{
+		return count;
+	}
+
+	// Shortcuts come grouped by u, merge them into each u's edges, then
+	// group them by x for the reversed edges
+	size_t first = 0;
+	for (size_t i = 1; i <= batch.size(); i++)
+	{
+		if (i == batch.size() || batch[i].source != batch[first].source)
+		{
+			mergeArcs(outArcs[batch[first].source], first, i, true, node);
+			first = i;
+		}
+	}
+	sort(batch.begin(), batch.end(), destinationBefore);
+	first = 0;
+	for (size_t i = 1; i <= batch.size(); i++)
+	{
+		if (i == batch.size()
+			|| batch[i].destination != batch[first].destination)
+		{
+			mergeArcs(inArcs[batch[first].destination], first, i, false,
+				node);
+			first = i;
+		}
+	}
+	return count;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void ContractionHierarchy::witnessSearch(int source,
+//					int skip, long long limit, int goals, int most, int hops)
+// Title:		Local search for witness paths
+// Description: Dijkstra from source over the remaining edges, never
+//					entering skip or passing cost limit, that stops once goals
+//					nodes marked in witnessGoal are settled, or after most
+//					nodes are settled. Paths of more than hops edges are
+//					not followed, which keeps the search small around high
+//					degree nodes. Leaves the costs found in witnessDist,
+//					INT_MAX for nodes not reached
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int source; node to search from
+//				int skip; node being contracted
+//				long long limit; highest cost of interest
+//				int goals; marked nodes other than source to settle
+//				int most; most nodes to settle
+//				int hops; most edges on a path followed
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Hop limit, stops when the goals are settled
+//-----------------------------------------------------------------------------
+void ContractionHierarchy::witnessSearch(int source, int skip,
+	long long limit, int goals, int most, int hops)
+{
+	for (size_t i = 0; i < witnessTouched.size(); i++)
+	{
+		witnessDist[witnessTouched[i]] = INT_MAX;
+	}
+	witnessTouched.clear();
+	witnessHeap.clear();
+
+	witnessDist[source] = 0;
+	witnessHops[source] = 0;
+	witnessTouched.push_back(source);
+	witnessHeap.push(0, source);
+	int settled = 0;
+	int d = 0;
+	int v = 0;
+	while (witnessHeap.pop(d, v))
+	{
+		if (d > witnessDist[v])
+		{
+			continue;
+		}
+		if (d > limit || ++settled > most)
+		{
+			break;
+		}
+		if (v != source && witnessGoal[v] && --goals <= 0)
+		{
+			break;
+		}
+		if (witnessHops[v] >= hops)
+		{
+			continue;
+		}
+		const vector<Arc> &arcs = outArcs[v];
+		for (size_t i = 0; i < arcs.size(); i++)
+		{
+			int w = arcs[i].node;
+			long long cost = (long long)d + arcs[i].weight;
+			if (w != skip && cost <= limit && cost < witnessDist[w])
+			{
+				if (witnessDist[w] == INT_MAX)
+				{
+					witnessTouched.push_back(w);
+				}
+				witnessDist[w] = (int)cost;
+				witnessHops[w] = witnessHops[v] + 1;
+				witnessHeap.push((int)cost, w);
+			}
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void ContractionHierarchy::mergeArcs(vector<Arc> &arcs,
+//					size_t first, size_t last, bool forward, int middle)
+// Title:		Adds a batch of edges
+// Description: Adds batch[first] .. batch[last - 1], which all share one
+//					end, to arcs. An edge to a node arcs already reaches
+//					only lowers its cost if cheaper. arcSlot holds the
+//					position of each node in arcs while the batch is merged,
+//					so the whole batch costs O(arcs + batch)
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	vector<Arc> &arcs; edges of the shared end
+//				size_t first; first edge of the batch in batch
+//				size_t last; one past the last edge of the batch
+//				bool forward; arcs leave the shared end, so each edge adds
+//					its destination, false to add its source
+//				int middle; node the edges pass, 0 for original edges
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void ContractionHierarchy::mergeArcs(vector<Arc> &arcs, size_t first,
+	size_t last, bool forward, int middle)
+{
+	for (size_t i = 0; i < arcs.size(); i++)
+	{
+		arcSlot[arcs[i].node] = (int)i;
+	}
+	for (size_t i = first; i < last; i++)
+	{
+		int other = forward ? batch[i].destination : batch[i].source;
+		int slot = arcSlot[other];
+		if (slot < 0)
+		{
+			Arc arc;
+			arc.node = other;
+			arc.weight = batch[i].weight;
+			arc.middle = middle;
+			arcSlot[other] = (int)arcs.size();
+			arcs.push_back(arc);
+		}
+		else if (batch[i].weight < arcs[slot].weight)
+		{
+			arcs[slot].weight = batch[i].weight;
+			arcs[slot].middle = middle;
+		}
+	}
+	for (size_t i = 0; i < arcs.size(); i++)
+	{
+		arcSlot[arcs[i].node] = -1;
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Function:	bool ContractionHierarchy::destinationBefore(
+//					const EdgeRecord &lhs, const EdgeRecord &rhs)
+// Title:		Orders shortcuts by destination
+// Description: Sort comparison grouping shortcuts that enter the same node
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	const EdgeRecord &lhs; first shortcut
+//				const EdgeRecord &rhs; second shortcut
+// Returns:		bool; true if lhs enters a lower numbered node
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+bool ContractionHierarchy::destinationBefore(const EdgeRecord &lhs,
+	const EdgeRecord &rhs)
+{
+	return lhs.destination < rhs.destination;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void ContractionHierarchy::removeArc(vector<Arc> &arcs,
+//					int node)
+// Title:		Removes an edge
+// Description: Removes the edge to node from arcs by moving the last edge
+//					into its place
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	vector<Arc> &arcs; edges of one node
+//				int node; node at the other end
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void ContractionHierarchy::removeArc(vector<Arc> &arcs, int node)
+{
+	for (size_t i = 0; i < arcs.size(); i++)
+	{
+		if (arcs[i].node == node)
+		{
+			arcs[i] = arcs.back();
+			arcs.pop_back();
+			return;
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void ContractionHierarchy::pack()
+// Title:		Packs the search graphs
+// Description: Lays the up arcs and the reversed down arcs of every node
+//					end to end, so each search scans one array per node as
+//					CSRGraph does
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void ContractionHierarchy::pack()
+{
+	upOffsets.assign(nodes + 2, 0);
+	downOffsets.assign(nodes + 2, 0);
+	for (int v = 1; v <= nodes; v++)
+	{
+		upOffsets[v + 1] = upOffsets[v] + (int)outArcs[v].size();
+		downOffsets[v + 1] = downOffsets[v] + (int)inArcs[v].size();
+	}
+	upArcs.clear();
+	downArcs.clear();
+	upArcs.reserve(upOffsets[nodes + 1]);
+	downArcs.reserve(downOffsets[nodes + 1]);
+	for (int v = 1; v <= nodes; v++)
+	{
+		upArcs.insert(upArcs.end(), outArcs[v].begin(), outArcs[v].end());
+		downArcs.insert(downArcs.end(), inArcs[v].begin(), inArcs[v].end());
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void ContractionHierarchy::clear()
+// Title:		Drops the hierarchy
+// Description: Frees the search graphs, leaving no hierarchy
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void ContractionHierarchy::clear()
+{
+	nodes = 0;
+	shortcuts = 0;
+	vector<int>().swap(upOffsets);
+	vector<Arc>().swap(upArcs);
+	vector<int>().swap(downOffsets);
+	vector<Arc>().swap(downArcs);
+	forwardDist.clear();
+	touched.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Function:	bool ContractionHierarchy::empty() const
+// Title:		Checks for a hierarchy
+// Description: Returns whether there is no hierarchy to query
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		bool; true if not built
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+bool ContractionHierarchy::empty() const
+{
+	return nodes == 0;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	int ContractionHierarchy::shortcutCount() const
+// Title:		Number of shortcuts
+// Description: Returns the number of shortcuts build added, a measure of
+//					how well the graph suits contraction
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		int; number of shortcuts
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+int ContractionHierarchy::shortcutCount() const
+{
+	return shortcuts;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	int ContractionHierarchy::query(int source, int target,
+//					vector<int> &nodes)
+// Title:		Point to point search
+// Description: Searches up the hierarchy from source and, over the reversed
+//					down arcs, up from target, always advancing the side with
+//					the smaller next cost. Each side stops once its next
+//					cost is no less than the best meeting found. A node
+//					reached more cheaply through an arc from a higher node
+//					is stalled, its arcs not scanned, as its cost can not be
+//					on a lowest cost path. The arcs of the best path are
+//					then unpacked into the original nodes
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int source; subscript of the source node
+//				int target; subscript of the destination node
+//				vector<int> &nodes; set to the path, empty if none
+// Returns:		int; lowest cost, INT_MAX if target is unreachable
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+int ContractionHierarchy::query(int source, int target, vector<int> &nodes)
+{
+	nodes.clear();
+	if (this->nodes == 0 || source < 1 || target < 1 || source > this->nodes
+		|| target > this->nodes)
+	{
+		return INT_MAX;
+	}
+	prepare();
+	forwardHeap.clear();
+	backwardHeap.clear();
+	reach(forwardDist, source, 0);
+	reach(backwardDist, target, 0);
+	forwardHeap.push(0, source);
+	backwardHeap.push(0, target);
+	SEARCH_COUNT(work.pushes += 2);
+
+	long long best = INT_MAX;
+	int meet = 0;
+	while (true)
+	{
+		if (!forwardHeap.empty() && forwardHeap.topKey() >= best)
+		{
+			forwardHeap.clear();
+		}
+		if (!backwardHeap.empty() && backwardHeap.topKey() >= best)
+		{
+			backwardHeap.clear();
+		}
+		if (forwardHeap.empty() && backwardHeap.empty())
+		{
+			break;
+		}
+
+		// Advance the side whose next node is closer
+		bool isForward = !forwardHeap.empty() && (backwardHeap.empty()
+			|| forwardHeap.topKey() <= backwardHeap.topKey());
+		BinaryHeap &heap = isForward ? forwardHeap : backwardHeap;
+		vector<int> &dist = isForward ? forwardDist : backwardDist;
+		vector<int> &parent = isForward ? forwardParent : backwardParent;
+		vector<int> &middle = isForward ? forwardMiddle : backwardMiddle;
+		const vector<int> &other = isForward ? backwardDist : forwardDist;
+		const int *offsets = isForward ? &upOffsets[0] : &downOffsets[0];
+		const vector<Arc> &arcs = isForward ? upArcs : downArcs;
+		const int *stallOffsets = isForward ? &downOffsets[0] : &upOffsets[0];
+		const vector<Arc> &stallArcs = isForward ? downArcs : upArcs;
+
+		int d = 0;
+		int v = 0;
+		heap.pop(d, v);
+		SEARCH_COUNT(work.pops++);
+		if (d > dist[v])
+		{
+			continue;
+		}
+		SEARCH_COUNT(work.settled++);
+		if (other[v] != INT_MAX && (long long)d + other[v] < best)
+		{
+			best = (long long)d + other[v];
+			meet = v;
+		}
+		if (stalled(dist, v, d, stallOffsets, stallArcs))
+		{
+			continue;
+		}
+		for (int i = offsets[v]; i < offsets[v + 1]; i++)
+		{
+			SEARCH_COUNT(work.relaxed++);
+			int w = arcs[i].node;
+			long long cost = (long long)d + arcs[i].weight;
+			if (cost < dist[w])
+			{
+				reach(dist, w, (int)cost);
+				parent[w] = v;
+				middle[w] = arcs[i].middle;
+				heap.push((int)cost, w);
+				SEARCH_COUNT(work.decreased++);
+				SEARCH_COUNT(work.pushes++);
+			}
+		}
+	}
+
+	if (meet == 0)
+	{
+		return INT_MAX;
+	}
+
+	// Arcs from source up to the meeting node, then down to target
+	chain.clear();
+	for (int v = meet; v != source; v = forwardParent[v])
+	{
+		chain.push_back(v);
+	}
+	nodes.push_back(source);
+	for (size_t i = chain.size(); i > 0; i--)
+	{
+		int v = chain[i - 1];
+		unpack(forwardParent[v], v, forwardMiddle[v], nodes);
+	}
+	for (int v = meet; v != target; v = backwardParent[v])
+	{
+		unpack(v, backwardParent[v], backwardMiddle[v], nodes);
+	}
+	return (int)best;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	bool ContractionHierarchy::stalled(const vector<int> &dist,
+//					int node, int cost, const int *offsets,
+//					const vector<Arc> &arcs) const
+// Title:		Stall on demand test
+// Description: Returns whether some higher node already reached by this
+//					side of the search has an arc to node making it cheaper
+//					than cost. The arcs given are those of the other side
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	const vector<int> &dist; costs of this side
+//				int node; node just settled
+//				int cost; its cost
+//				const int *offsets; first arc of each node of the other side
+//				const vector<Arc> &arcs; arcs of the other side
+// Returns:		bool; true if node need not be scanned
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+bool ContractionHierarchy::stalled(const vector<int> &dist, int node,
+	int cost, const int *offsets, const vector<Arc> &arcs) const
+{
+	for (int i = offsets[node]; i < offsets[node + 1]; i++)
+	{
+		int w = arcs[i].node;
+		if (dist[w] != INT_MAX && (long long)dist[w] + arcs[i].weight < cost)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void ContractionHierarchy::unpack(int from, int to,
+//					int middle, vector<int> &nodes)
+// Title:		Unpacks an arc
+// Description: Appends the nodes after from on the original path the arc
+//					from from to to stands for. A shortcut through middle
+//					stands for a down arc of middle from from and an up arc
+//					of middle to to, which may be shortcuts in turn, so
+//					arcs are unpacked from a stack until only edges are left
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int from; node the arc leaves
+//				int to; node the arc enters
+//				int middle; node a shortcut passes, 0 for an edge
+//				vector<int> &nodes; path the nodes are appended to
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void ContractionHierarchy::unpack(int from, int to, int middle,
+	vector<int> &nodes)
+{
+	pending.clear();
+	pending.push_back(from);
+	pending.push_back(to);
+	pending.push_back(middle);
+	while (!pending.empty())
+	{
+		int m = pending.back();
+		pending.pop_back();
+		int x = pending.back();
+		pending.pop_back();
+		int u = pending.back();
+		pending.pop_back();
+		if (m == 0)
+		{
+			nodes.push_back(x);
+			continue;
+		}
+
+		// Second half goes on first so the first half comes off first
+		const Arc *second = findArc(&upOffsets[0], upArcs, m, x);
+		const Arc *first = findArc(&downOffsets[0], downArcs, m, u);
+		pending.push_back(m);
+		pending.push_back(x);
+		pending.push_back(second == NULL ? 0 : second->middle);
+		pending.push_back(u);
+		pending.push_back(m);
+		pending.push_back(first == NULL ? 0 : first->middle);
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Function:	const Arc *ContractionHierarchy::findArc(const int *offsets,
+//					const vector<Arc> &arcs, int node, int other) const
+// Title:		Finds an arc
+// Description: Returns the arc of node leading to other in one of the
+//					packed search graphs
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	const int *offsets; first arc of each node
+//				const vector<Arc> &arcs; packed arcs
+//				int node; node the arc belongs to
+//				int other; node at its other end
+// Returns:		const Arc *; the arc, NULL if node has none to other
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+const ContractionHierarchy::Arc *ContractionHierarchy::findArc(
+	const int *offsets, const vector<Arc> &arcs, int node, int other) const
+{
+	for (int i = offsets[node]; i < offsets[node + 1]; i++)
+	{
+		if (arcs[i].node == other)
+		{
+			return &arcs[i];
+		}
+	}
+	return NULL;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void ContractionHierarchy::prepare()
+// Title:		Resets query storage
+// Description: Sizes query storage for the hierarchy and sets the nodes
+//					reached by the previous query back to unreached
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void ContractionHierarchy::prepare()
+{
+	if ((int)forwardDist.size() != nodes + 1)
+	{
+		forwardDist.assign(nodes + 1, INT_MAX);
+		backwardDist.assign(nodes + 1, INT_MAX);
+		forwardParent.assign(nodes + 1, 0);
+		backwardParent.assign(nodes + 1, 0);
+		forwardMiddle.assign(nodes + 1, 0);
+		backwardMiddle.assign(nodes + 1, 0);
+		touched.clear();
+		return;
+	}
+	for (size_t i = 0; i < touched.size(); i++)
+	{
+		forwardDist[touched[i]] = INT_MAX;
+		backwardDist[touched[i]] = INT_MAX;
+	}
+	touched.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void ContractionHierarchy::reach(vector<int> &dist, int node,
+//					int cost)
+// Title:		Sets a query cost
+// Description: Sets the cost of node, remembering the node the first time it
+//					is reached so prepare can reset it
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	vector<int> &dist; forwardDist or backwardDist
+//				int node; subscript of the node reached
+//				int cost; cost of reaching it
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void ContractionHierarchy::reach(vector<int> &dist, int node, int cost)
+{
+	if (forwardDist[node] == INT_MAX && backwardDist[node] == INT_MAX)
+	{
+		touched.push_back(node);
+	}
+	dist[node] = cost;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	const SearchCounters &ContractionHierarchy::counters() const
+// Title:		Work counters
+// Description: Returns the nodes settled, arcs relaxed, costs lowered and
+//					heap operations of every query since the counters were
+//					cleared. Building is not counted
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		const SearchCounters &; counts of this hierarchy
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+const SearchCounters &ContractionHierarchy::counters() const
+{
+	return work;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void ContractionHierarchy::clearCounters()
+// Title:		Zeroes the work counters
+// Description: Sets every count of counters back to zero
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void ContractionHierarchy::clearCounters()
+{
+	memset(&work, 0, sizeof(work));
+}
@@ -0,0 +1,123 @@
+#ifndef CONTRACTION_H
+#define CONTRACTION_H
+//----------------------------------------------------------------------------
+// File: contraction.h
+//
+// Description: Function outlines for the ContractionHierarchy class, a
+//				preprocessed form of a static graph for fast point to point
+//				queries. Nodes are contracted one at a time, least important
+//				first, and whenever removing a node would lengthen a lowest
+//				cost path between two of its remaining neighbours a shortcut
+//				edge through it is added. Every edge then leads up or down
+//				the contraction order, and a query searches only upward from
+//				both ends, settling a few hundred nodes on road like graphs.
+//				Shortcuts remember the node they pass, so a path found over
+//				them unpacks back to the nodes of the original graph
+//
+// Programmer:	Anthony Waddell
+//
+// Environment: Hardware: PC, i7
+//              Software: OS: Windows 10
+//              Compiles under Microsoft Visual C++ 2015, g++
+//-----------------------------------------------------------------------------
+#include "csrgraph.h"
+#include "pathheap.h"
+#include "searchstats.h"
+#include <limits.h>
+#include <stdint.h>
+#include <vector>
+
+using namespace std;
+
+class ContractionHierarchy
+{
+public:
+	// Constructor
+	ContractionHierarchy();
+
+	// Contract every node of graph, dropping any earlier hierarchy
+	void build(const CSRGraph &graph);
+	void clear();
+	bool empty() const;
+	int shortcutCount() const;
+
+	// Lowest cost path, nodes is set to the path in the original graph,
+	// returns INT_MAX if there is none
+	int query(int source, int target, vector<int> &nodes);
+
+	// Work done by queries since the counters were cleared
+	const SearchCounters &counters() const;
+	void clearCounters();
+
+private:
+
+	// Edge of the hierarchy, an original edge or a shortcut
+	struct Arc
+	{
+		int node;              // node at the other end
+		int weight;            // cost of the edge
+		int middle;            // node a shortcut passes, 0 for an edge
+	};
+
+	// Contraction
+	int contract(int node, bool apply);
+	int priority(int node);
+	void witnessSearch(int source, int skip, long long limit, int goals,
+		int most, int hops);
+	void mergeArcs(vector<Arc> &arcs, size_t first, size_t last,
+		bool forward, int middle);
+	static bool destinationBefore(const EdgeRecord &lhs,
+		const EdgeRecord &rhs);
+	static void removeArc(vector<Arc> &arcs, int node);
+	void pack();
+
+	// Query
+	void prepare();
+	void reach(vector<int> &dist, int node, int cost);
+	bool stalled(const vector<int> &dist, int node, int cost,
+		const int *offsets, const vector<Arc> &arcs) const;
+	void unpack(int from, int to, int middle, vector<int> &nodes);
+	const Arc *findArc(const int *offsets, const vector<Arc> &arcs,
+		int node, int other) const;
+
+	static const int WITNESS_LIMIT = 500;  // most nodes a witness search
+	                                       // settles
+	static const int PRIORITY_LIMIT = 50;  // the same when only counting
+	                                       // shortcuts for a priority
+	static const int WITNESS_HOPS = 5;     // most edges on a witness path
+	static const int PRIORITY_HOPS = 2;    // the same for a priority
+
+	int nodes;                            // number of nodes, 0 if not built
+	int shortcuts;                        // shortcuts added by build
+	vector<int> upOffsets;                // first up arc of each node
+	vector<Arc> upArcs;                   // edges to higher nodes
+	vector<int> downOffsets;              // first down arc of each node
+	vector<Arc> downArcs;                 // edges from higher nodes, reversed
+
+	vector<vector<Arc> > outArcs;         // remaining edges while building
+	vector<vector<Arc> > inArcs;          // remaining edges, reversed
+	vector<int> neighboursGone;           // contracted neighbours of a node
+	vector<int> witnessDist;              // costs of a witness search
+	vector<int> witnessHops;              // edges on each of those paths
+	vector<uint8_t> witnessGoal;          // ends of the contracted node's
+	                                      // outgoing edges
+	vector<int> witnessTouched;           // nodes a witness search reached
+	BinaryHeap witnessHeap;               // queue of a witness search
+	vector<int> arcSlot;                  // position of each node in the
+	                                      // edges mergeArcs is adding to
+	vector<EdgeRecord> batch;             // edges waiting to be merged
+
+	vector<int> forwardDist;              // query costs from source
+	vector<int> backwardDist;             // query costs to target
+	vector<int> forwardParent;            // previous node toward source
+	vector<int> backwardParent;           // next node toward target
+	vector<int> forwardMiddle;            // middle of the arc from parent
+	vector<int> backwardMiddle;           // middle of the arc to parent
+	vector<int> touched;                  // nodes reached by the last query
+	vector<int> chain;                    // nodes from meeting back to source
+	vector<int> pending;                  // arcs left to unpack, 3 ints each
+	BinaryHeap forwardHeap;               // queue of the upward search
+	BinaryHeap backwardHeap;              // queue of the downward search
+	SearchCounters work;                  // counts of settles, relaxations
+};
+#endif
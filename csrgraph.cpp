@@ -0,0 +1,504 @@
+//-----------------------------------------------------------------------------
+// File:		csrgraph.cpp
+// Programmer:	Anthony Waddell
+// Resources:	https://en.wikipedia.org/wiki/Sparse_matrix
+//-----------------------------------------------------------------------------
+#include "csrgraph.h"
+
+//-----------------------------------------------------------------------------
+// Function:	CSRGraph::CSRGraph()
+// Title:		Constructor
+// Description: Constructs a graph with no nodes and no edges
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		N/A
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Counts edges in use
+//-----------------------------------------------------------------------------
+CSRGraph::CSRGraph()
+{
+	nodes = 0;
+	edgeTotal = 0;
+	liveTotal = 0;
+	offsets.assign(2, 0);
+	point();
+}
+
+//-----------------------------------------------------------------------------
+// Function:	CSRGraph::CSRGraph(const CSRGraph &other)
+// Title:		Copy constructor
+// Description: Copies other. Owned arrays are copied, attached arrays are
+//					shared with other
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	const CSRGraph &other; graph to copy
+// Returns:		N/A
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Counts edges in use
+//-----------------------------------------------------------------------------
+CSRGraph::CSRGraph(const CSRGraph &other)
+{
+	nodes = 0;
+	edgeTotal = 0;
+	liveTotal = 0;
+	*this = other;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	CSRGraph& CSRGraph::operator=(const CSRGraph &other)
+// Title:		Assignment operator
+// Description: Copies other. Owned arrays are copied, attached arrays are
+//					shared with other
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	const CSRGraph &other; graph to copy
+// Returns:		CSRGraph&; this graph
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Counts edges in use
+//-----------------------------------------------------------------------------
+CSRGraph& CSRGraph::operator=(const CSRGraph &other)
+{
+	if (this != &other)
+	{
+		nodes = other.nodes;
+		edgeTotal = other.edgeTotal;
+		liveTotal = other.liveTotal;
+		offsets = other.offsets;
+		targets = other.targets;
+		weights = other.weights;
+		owned = other.owned;
+		offsetData = other.offsetData;
+		targetData = other.targetData;
+		weightData = other.weightData;
+		if (owned)
+		{
+			point();
+		}
+	}
+	return *this;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void CSRGraph::build(int nodes,
+//					const vector<EdgeRecord> &edges)
+// Title:		Builds the packed arrays
+// Description: Counts the edges of each node, turns the counts into offsets
+//					and places every edge in its node's range. Edges of one
+//					node keep the order they have in the stream. Edges
+//					naming nodes outside 1..nodes are dropped
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int nodes; number of nodes in the graph
+//				const vector<EdgeRecord> &edges; edges in stream order
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Counts edges in use
+//-----------------------------------------------------------------------------
+void CSRGraph::build(int nodes, const vector<EdgeRecord> &edges)
+{
+	this->nodes = max(nodes, 0);
+	offsets.assign(this->nodes + 2, 0);
+
+	// Count edges leaving each node, shifted by one for the prefix sum
+	for (size_t i = 0; i < edges.size(); i++)
+	{
+		const EdgeRecord &e = edges[i];
+		if (e.source >= 1 && e.source <= this->nodes && e.destination >= 1
+			&& e.destination <= this->nodes)
+		{
+			offsets[e.source + 1]++;
+		}
+	}
+	for (int i = 1; i <= this->nodes + 1; i++)
+	{
+		offsets[i] += offsets[i - 1];
+	}
+
+	// Place each edge at the next free slot of its node
+	edgeTotal = offsets[this->nodes + 1];
+	targets.resize(edgeTotal);
+	weights.resize(edgeTotal);
+	vector<int> next(offsets.begin(), offsets.end() - 1);
+	liveTotal = 0;
+	for (size_t i = 0; i < edges.size(); i++)
+	{
+		const EdgeRecord &e = edges[i];
+		if (e.source >= 1 && e.source <= this->nodes && e.destination >= 1
+			&& e.destination <= this->nodes)
+		{
+			int slot = next[e.source]++;
+			targets[slot] = e.destination;
+			weights[slot] = e.weight;
+			liveTotal += e.weight != INT_MAX;
+		}
+	}
+	point();
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void CSRGraph::buildReverse(const CSRGraph &graph)
+// Title:		Builds the reversed graph
+// Description: Builds this graph from graph with every edge pointing the
+//					other way, so the edges entering a node can be scanned
+//					like the edges leaving it
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	const CSRGraph &graph; graph to reverse
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void CSRGraph::buildReverse(const CSRGraph &graph)
+{
+	vector<EdgeRecord> reversed(graph.edgeTotal);
+	for (int v = 1; v <= graph.nodes; v++)
+	{
+		for (int i = graph.offsetData[v]; i < graph.offsetData[v + 1]; i++)
+		{
+			reversed[i].source = graph.targetData[i];
+			reversed[i].destination = v;
+			reversed[i].weight = graph.weightData[i];
+		}
+	}
+	build(graph.nodes, reversed);
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void CSRGraph::attach(int nodes, int edges,
+//					const int *offsets, const int *targets,
+//					const int *weights)
+// Title:		Uses arrays in place
+// Description: Makes the graph read arrays owned elsewhere without copying
+//					them, reading the weights once to count edges in use.
+//					The first change to an edge copies the arrays into the
+//					graph, so the attached memory is never written
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int nodes; number of nodes in the graph
+//				int edges; number of edges in the graph
+//				const int *offsets; nodes + 2 offsets
+//				const int *targets; edges destinations
+//				const int *weights; edges costs
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Counts edges in use
+//-----------------------------------------------------------------------------
+void CSRGraph::attach(int nodes, int edges, const int *offsets,
+	const int *targets, const int *weights)
+{
+	this->nodes = nodes;
+	edgeTotal = edges;
+	this->offsets.clear();
+	this->targets.clear();
+	this->weights.clear();
+	owned = false;
+	offsetData = offsets;
+	targetData = targets;
+	weightData = weights;
+	liveTotal = edges - (int)count(weights, weights + edges, INT_MAX);
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void CSRGraph::point()
+// Title:		Uses owned arrays
+// Description: Points the arrays in use at the owned vectors, called after
+//					anything that may have moved them
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void CSRGraph::point()
+{
+	owned = true;
+	offsetData = &offsets[0];
+	targetData = targets.empty() ? NULL : &targets[0];
+	weightData = weights.empty() ? NULL : &weights[0];
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void CSRGraph::own()
+// Title:		Copies attached arrays
+// Description: Copies attached arrays into owned vectors before a change
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void CSRGraph::own()
+{
+	if (owned)
+	{
+		return;
+	}
+	offsets.assign(offsetData, offsetData + nodes + 2);
+	targets.assign(targetData, targetData + edgeTotal);
+	weights.assign(weightData, weightData + edgeTotal);
+	point();
+}
+
+//-----------------------------------------------------------------------------
+// Function:	int CSRGraph::nodeCount() const
+// Title:		Number of nodes
+// Description: Returns the number of nodes, node subscripts run 1..nodes
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		int; number of nodes
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+int CSRGraph::nodeCount() const
+{
+	return nodes;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	int CSRGraph::edgeCount() const
+// Title:		Number of edges
+// Description: Returns the number of stored edges, including removed edges
+//					and spare slots, whose weight is INT_MAX
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		int; number of edges
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Counts spare slots
+//-----------------------------------------------------------------------------
+int CSRGraph::edgeCount() const
+{
+	return edgeTotal;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	int CSRGraph::liveEdgeCount() const
+// Title:		Number of edges in use
+// Description: Returns the number of edges whose weight is not INT_MAX,
+//					leaving out removed edges and spare slots
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		int; number of edges in use
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+int CSRGraph::liveEdgeCount() const
+{
+	return liveTotal;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	const int *CSRGraph::offsetArray() const
+// Title:		Offset array
+// Description: Returns offsets, nodes + 2 entries, where the edges of node
+//					i are at positions offsets[i] up to offsets[i + 1]
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		const int *; first entry of the offsets
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+const int *CSRGraph::offsetArray() const
+{
+	return offsetData;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	const int *CSRGraph::targetArray() const
+// Title:		Target array
+// Description: Returns the destination node of every edge
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		const int *; first entry of the targets, NULL if no edges
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+const int *CSRGraph::targetArray() const
+{
+	return targetData;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	const int *CSRGraph::weightArray() const
+// Title:		Weight array
+// Description: Returns the cost of every edge
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		const int *; first entry of the weights, NULL if no edges
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+const int *CSRGraph::weightArray() const
+{
+	return weightData;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	int CSRGraph::findEdge(int source, int destination) const
+// Title:		Finds an edge
+// Description: Scans the edges of source for destination
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int source; subscript of the node the edge leaves
+//				int destination; subscript of the node the edge enters
+// Returns:		int; position of the edge, -1 if there is none
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+int CSRGraph::findEdge(int source, int destination) const
+{
+	if (source < 1 || source > nodes)
+	{
+		return -1;
+	}
+	for (int i = offsetData[source]; i < offsetData[source + 1]; i++)
+	{
+		if (targetData[i] == destination)
+		{
+			return i;
+		}
+	}
+	return -1;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void CSRGraph::setWeight(int edge, int weight)
+// Title:		Changes the cost of an edge
+// Description: Changes the cost of an existing edge in place. Setting it to
+//					INT_MAX removes the edge without moving any other edge
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int edge; position returned by findEdge
+//				int weight; new cost of the edge
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Counts edges in use
+//-----------------------------------------------------------------------------
+void CSRGraph::setWeight(int edge, int weight)
+{
+	own();
+	liveTotal += (weight != INT_MAX) - (weights[edge] != INT_MAX);
+	weights[edge] = weight;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void CSRGraph::addEdge(int source, int destination, int weight)
+// Title:		Adds an edge
+// Description: Places an edge in the first slot of source holding INT_MAX,
+//					a removed edge or spare room left by grow. Only when
+//					source has no such slot are the arrays laid out again
+//					with room to spare, so most additions cost O(degree)
+//					instead of O(V + E). Use findEdge and setWeight when the
+//					edge may already exist
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int source; subscript of the node the edge leaves
+//				int destination; subscript of the node the edge enters
+//				int weight; cost of the edge
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Fills free slots, grows only when source is full
+//				10/17/26 AW Counts edges in use
+//-----------------------------------------------------------------------------
+void CSRGraph::addEdge(int source, int destination, int weight)
+{
+	own();
+	int slot = freeSlot(source);
+	if (slot < 0)
+	{
+		grow();
+		slot = freeSlot(source);
+	}
+	targets[slot] = destination;
+	weights[slot] = weight;
+	liveTotal += weight != INT_MAX;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	int CSRGraph::freeSlot(int source) const
+// Title:		Finds a free slot
+// Description: Scans the range of source for a slot holding INT_MAX
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int source; subscript of the node to scan
+// Returns:		int; position of the slot, -1 if source has none
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+int CSRGraph::freeSlot(int source) const
+{
+	for (int i = offsets[source]; i < offsets[source + 1]; i++)
+	{
+		if (weights[i] == INT_MAX)
+		{
+			return i;
+		}
+	}
+	return -1;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void CSRGraph::grow()
+// Title:		Lays out the arrays with spare room
+// Description: Copies the edges of each node, in order, into a range with
+//					room for half as many again plus one. Removed edges are
+//					dropped. Spare slots hold INT_MAX, which every search
+//					already skips, and point back at their own node so the
+//					arrays stay valid to write to a graph file
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void CSRGraph::grow()
+{
+	vector<int> start(nodes + 2, 0);
+	for (int v = 1; v <= nodes; v++)
+	{
+		int live = 0;
+		for (int i = offsets[v]; i < offsets[v + 1]; i++)
+		{
+			live += weights[i] != INT_MAX;
+		}
+		start[v + 1] = start[v] + live + live / 2 + 1;
+	}
+
+	vector<int> newTargets(start[nodes + 1]);
+	vector<int> newWeights(start[nodes + 1], INT_MAX);
+	for (int v = 1; v <= nodes; v++)
+	{
+		int slot = start[v];
+		for (int i = offsets[v]; i < offsets[v + 1]; i++)
+		{
+			if (weights[i] != INT_MAX)
+			{
+				newTargets[slot] = targets[i];
+				newWeights[slot++] = weights[i];
+			}
+		}
+		fill(newTargets.begin() + slot, newTargets.begin() + start[v + 1], v);
+	}
+	offsets.swap(start);
+	targets.swap(newTargets);
+	weights.swap(newWeights);
+	edgeTotal = offsets[nodes + 1];
+	point();
+}
@@ -0,0 +1,89 @@
+#ifndef CSRGRAPH_H
+#define CSRGRAPH_H
+//----------------------------------------------------------------------------
+// File: csrgraph.h
+//
+// Description: Function outlines for the CSRGraph class, a compressed sparse
+//				row graph. The edges of node i are stored contiguously in
+//				targets[offsets[i]] .. targets[offsets[i + 1] - 1] with their
+//				weights at the same positions of weights. The arrays are
+//				either owned by the graph or attached from memory owned
+//				elsewhere, such as a mapped graph file. build packs the
+//				edges tightly. Once addEdge finds a node full it lays the
+//				arrays out again with spare slots, holding INT_MAX like a
+//				removed edge, so later additions rarely move anything
+//
+// Programmer:	Anthony Waddell
+//
+// Environment: Hardware: PC, i7
+//              Software: OS: Windows 10
+//              Compiles under Microsoft Visual C++ 2015, g++
+//-----------------------------------------------------------------------------
+#include <algorithm>
+#include <limits.h>
+#include <vector>
+
+using namespace std;
+
+// One edge as read from a data file
+struct EdgeRecord
+{
+	int source;                // subscript of the node the edge leaves
+	int destination;           // subscript of the node the edge enters
+	int weight;                // cost of the edge
+};
+
+class CSRGraph
+{
+public:
+	// Constructors and assignment
+	CSRGraph();
+	CSRGraph(const CSRGraph &other);
+	CSRGraph& operator=(const CSRGraph &other);
+
+	// Build from an edge stream, keeping stream order within each node
+	void build(int nodes, const vector<EdgeRecord> &edges);
+	void buildReverse(const CSRGraph &graph);
+
+	// Use arrays owned elsewhere in place, they must outlive the graph
+	void attach(int nodes, int edges, const int *offsets, const int *targets,
+		const int *weights);
+
+	// Graph properties
+	int nodeCount() const;
+	int edgeCount() const;
+	int liveEdgeCount() const;
+
+	// Packed arrays, edges of node i are [offsetArray()[i], offsetArray()[i+1])
+	const int *offsetArray() const;
+	const int *targetArray() const;
+	const int *weightArray() const;
+
+	// Edge lookup and update, a weight of INT_MAX marks a removed edge
+	int findEdge(int source, int destination) const;
+	void setWeight(int edge, int weight);
+	void addEdge(int source, int destination, int weight);
+
+private:
+
+	// Array ownership
+	void point();
+	void own();
+
+	// Room for added edges
+	int freeSlot(int source) const;
+	void grow();
+
+	int nodes;                            // number of nodes, index 0 unused
+	int edgeTotal;                        // number of edge slots, spare
+	                                      // slots included
+	int liveTotal;                        // edges not weighing INT_MAX
+	vector<int> offsets;                  // first edge of each node, nodes + 2
+	vector<int> targets;                  // destination of each edge
+	vector<int> weights;                  // cost of each edge
+	bool owned;                           // arrays are the vectors above
+	const int *offsetData;                // offsets in use
+	const int *targetData;                // targets in use
+	const int *weightData;                // weights in use
+};
+#endif
\ No newline at end of file
@@ -0,0 +1,520 @@
+//-----------------------------------------------------------------------------
+// File:		deltastepping.cpp
+// Programmer:	Anthony Waddell
+// Resources:	Meyer, Sanders, "Delta-stepping: a parallelizable shortest
+//					path algorithm", J. Algorithms 49(1), 2003
+//-----------------------------------------------------------------------------
+#include "deltastepping.h"
+#include <algorithm>
+#include <string.h>
+
+//-----------------------------------------------------------------------------
+// Function:	DeltaStepping::DeltaStepping()
+// Title:		Constructor
+// Description: Constructs a search that chooses its bucket width from the
+//					edges of each graph
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		N/A
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+DeltaStepping::DeltaStepping() : claimed(0)
+{
+	delta = 0;
+	width = 1;
+	slots = 2;
+	graph = NULL;
+	bucket = 0;
+	finished = true;
+	threadCount = 1;
+	waiting = 0;
+	generation = 0;
+	clearCounters();
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void DeltaStepping::setDelta(int delta)
+// Title:		Sets the bucket width
+// Description: Sets the width of the cost buckets of later searches. 0, the
+//					default, chooses it from the edges of each graph
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int delta; bucket width, 0 for automatic
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void DeltaStepping::setDelta(int delta)
+{
+	this->delta = max(delta, 0);
+}
+
+//-----------------------------------------------------------------------------
+// Function:	int DeltaStepping::lastDelta() const
+// Title:		Bucket width in use
+// Description: Returns the bucket width the last search ran with, after
+//					automatic choice and the BUCKET_LIMIT cap
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		int; bucket width of the last search
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+int DeltaStepping::lastDelta() const
+{
+	return width;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void DeltaStepping::run(const CSRGraph &graph, int source,
+//					int threads, vector<int> &dist, vector<int> &path)
+// Title:		Single source shortest paths
+// Description: Finds the lowest cost from source to every node of graph on
+//					up to threads threads, the calling thread being one of
+//					them. Unreachable nodes are left with distance INT_MAX.
+//					The path entry of a node is the previous node on a lowest
+//					cost path, 0 for the source and unreachable nodes. Costs
+//					are those of DijkstraEngine::run; where two paths tie,
+//					the previous node may be either
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	const CSRGraph &graph; edges of each node
+//				int source; subscript of the source node
+//				int threads; most threads to use
+//				vector<int> &dist; set to the lowest cost of each node
+//				vector<int> &path; set to the previous node of each node
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void DeltaStepping::run(const CSRGraph &graph, int source, int threads,
+	vector<int> &dist, vector<int> &path)
+{
+	int nodes = graph.nodeCount();
+	this->graph = &graph;
+	chooseWidth(graph);
+
+	// Atomics cannot be copied, so storage is replaced when the size changes
+	if ((int)state.size() != nodes + 1)
+	{
+		vector<atomic<uint64_t> >(nodes + 1).swap(state);
+		vector<atomic<int> >(nodes + 1).swap(relaxedAt);
+	}
+	for (int v = 0; v <= nodes; v++)
+	{
+		state[v].store((uint64_t)INT_MAX << 32, memory_order_relaxed);
+		relaxedAt[v].store(INT_MAX, memory_order_relaxed);
+	}
+	threadCount = max(threads, 1);
+	workers.resize(threadCount);
+	for (int t = 0; t < threadCount; t++)
+	{
+		workers[t].next.clear();
+		workers[t].settled.clear();
+		workers[t].buckets.assign(slots, vector<int>());
+		workers[t].nextBucket = INT_MAX;
+		memset(&workers[t].work, 0, sizeof(workers[t].work));
+	}
+
+	state[source].store(0, memory_order_relaxed);
+	bucket = 0;
+	finished = false;
+	frontier.assign(1, source);
+	claimed.store(0);
+	waiting = 0;
+	SEARCH_COUNT(work.pushes++);
+
+	// The calling thread works as thread 0
+	vector<thread> helpers;
+	for (int t = 1; t < threadCount; t++)
+	{
+		helpers.push_back(thread(&DeltaStepping::worker, this, t));
+	}
+	worker(0);
+	for (size_t t = 0; t < helpers.size(); t++)
+	{
+		helpers[t].join();
+	}
+	for (int t = 0; t < threadCount; t++)
+	{
+		work.add(workers[t].work);
+	}
+
+	dist.resize(nodes + 1);
+	path.resize(nodes + 1);
+	for (int v = 0; v <= nodes; v++)
+	{
+		uint64_t packed = state[v].load(memory_order_relaxed);
+		dist[v] = (int)(packed >> 32);
+		path[v] = (int)(uint32_t)packed;
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void DeltaStepping::chooseWidth(const CSRGraph &graph)
+// Title:		Sets the bucket width
+// Description: Uses the width given to setDelta or, for 0, the heaviest
+//					edge over the average out degree, counting only edges in
+//					use, so each bucket holds about a node's worth of edge
+//					weight, as suggested for random weights by Meyer and
+//					Sanders. A later bucket is at most the heaviest edge
+//					past the current one, so that many buckets are kept and
+//					reused in turn. The width is raised if more than
+//					BUCKET_LIMIT would be needed
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	const CSRGraph &graph; graph about to be searched
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Degree from edges in use
+//-----------------------------------------------------------------------------
+void DeltaStepping::chooseWidth(const CSRGraph &graph)
+{
+	const int *weights = graph.weightArray();
+	int edges = graph.edgeCount();
+	int heaviest = 0;
+	for (int e = 0; e < edges; e++)
+	{
+		if (weights[e] != INT_MAX)
+		{
+			heaviest = max(heaviest, weights[e]);
+		}
+	}
+
+	width = delta;
+	if (width == 0)
+	{
+		int degree = max(graph.liveEdgeCount() / max(graph.nodeCount(), 1),
+			1);
+		width = heaviest / degree;
+	}
+	width = max(width, heaviest / (BUCKET_LIMIT - 2) + 1);
+	slots = heaviest / width + 2;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void DeltaStepping::worker(int id)
+// Title:		Search thread
+// Description: Loop run by every thread of a search. Light rounds repeat
+//					while nodes come back into the bucket, then heavy edges
+//					are relaxed and the next bucket is chosen. Thread 0
+//					gathers the nodes for the next round between barriers
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int id; thread number, 0 for the calling thread
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void DeltaStepping::worker(int id)
+{
+	StepWorker &own = workers[id];
+	while (true)
+	{
+		// Light edges until the bucket stays empty
+		while (true)
+		{
+			lightRound(own);
+			wait();
+			if (id == 0)
+			{
+				gatherNext();
+			}
+			wait();
+			if (frontier.empty())
+			{
+				break;
+			}
+		}
+
+		// Costs in the bucket are final, so heavy edges go once
+		heavyEdges(own);
+		wait();
+		if (id == 0)
+		{
+			advance();
+		}
+		wait();
+		if (finished)
+		{
+			break;
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void DeltaStepping::lightRound(StepWorker &own)
+// Title:		Relaxes light edges of the frontier
+// Description: Claims frontier nodes CHUNK at a time and relaxes their
+//					light edges. Entries left from a bucket a node has
+//					since left, or for a cost its edges were already
+//					relaxed at, are skipped. A node first seen in the
+//					bucket is kept for heavyEdges
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	StepWorker &own; storage of the calling thread
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void DeltaStepping::lightRound(StepWorker &own)
+{
+	const int *offsets = graph->offsetArray();
+	const int *targets = graph->targetArray();
+	const int *weights = graph->weightArray();
+	int count = (int)frontier.size();
+	int start = 0;
+	while ((start = claimed.fetch_add(CHUNK)) < count)
+	{
+		int end = min(start + CHUNK, count);
+		for (int i = start; i < end; i++)
+		{
+			int u = frontier[i];
+			SEARCH_COUNT(own.work.pops++);
+			int d = (int)(state[u].load(memory_order_relaxed) >> 32);
+			if (d / width != bucket)
+			{
+				continue;
+			}
+			int before = relaxedAt[u].exchange(d);
+			if (before == d)
+			{
+				continue;
+			}
+			if (before == INT_MAX)
+			{
+				own.settled.push_back(u);
+				SEARCH_COUNT(own.work.settled++);
+			}
+			for (int e = offsets[u]; e < offsets[u + 1]; e++)
+			{
+				if (weights[e] <= width)
+				{
+					relax(own, targets[e], u, (long long)d + weights[e]);
+				}
+			}
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void DeltaStepping::heavyEdges(StepWorker &own)
+// Title:		Relaxes heavy edges of the bucket
+// Description: Relaxes the heavy edges of the nodes this thread settled in
+//					the bucket, which all lead to later buckets, then finds
+//					the lowest later bucket it holds nodes for
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	StepWorker &own; storage of the calling thread
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void DeltaStepping::heavyEdges(StepWorker &own)
+{
+	const int *offsets = graph->offsetArray();
+	const int *targets = graph->targetArray();
+	const int *weights = graph->weightArray();
+	for (size_t i = 0; i < own.settled.size(); i++)
+	{
+		int u = own.settled[i];
+		int d = (int)(state[u].load(memory_order_relaxed) >> 32);
+		for (int e = offsets[u]; e < offsets[u + 1]; e++)
+		{
+			if (weights[e] > width && weights[e] != INT_MAX)
+			{
+				relax(own, targets[e], u, (long long)d + weights[e]);
+			}
+		}
+	}
+	own.settled.clear();
+
+	own.nextBucket = INT_MAX;
+	for (int step = 1; step < slots; step++)
+	{
+		if (!own.buckets[(bucket + step) % slots].empty())
+		{
+			own.nextBucket = bucket + step;
+			break;
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void DeltaStepping::relax(StepWorker &own, int node,
+//					int from, long long cost)
+// Title:		Relaxes one edge
+// Description: Lowers the cost of node to cost through from if that is
+//					lower, comparing and swapping cost and previous node as
+//					one word, and queues node in the bucket of its new cost
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	StepWorker &own; storage of the calling thread
+//				int node; node the edge enters
+//				int from; node the edge leaves
+//				long long cost; cost of node through the edge
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void DeltaStepping::relax(StepWorker &own, int node, int from, long long cost)
+{
+	if (cost >= INT_MAX)
+	{
+		return;
+	}
+	SEARCH_COUNT(own.work.relaxed++);
+	uint64_t wanted = ((uint64_t)cost << 32) | (uint32_t)from;
+	uint64_t current = state[node].load(memory_order_relaxed);
+	while ((current >> 32) > (uint64_t)cost)
+	{
+		if (state[node].compare_exchange_weak(current, wanted,
+			memory_order_relaxed))
+		{
+			SEARCH_COUNT(own.work.decreased++);
+			SEARCH_COUNT(own.work.pushes++);
+			int target = (int)(cost / width);
+			if (target == bucket)
+			{
+				own.next.push_back(node);
+			}
+			else
+			{
+				own.buckets[target % slots].push_back(node);
+			}
+			return;
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void DeltaStepping::gatherNext()
+// Title:		Collects the next light round
+// Description: Moves the nodes every thread put back into the bucket into
+//					the frontier. Run by thread 0 alone between barriers
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void DeltaStepping::gatherNext()
+{
+	frontier.clear();
+	for (int t = 0; t < threadCount; t++)
+	{
+		frontier.insert(frontier.end(), workers[t].next.begin(),
+			workers[t].next.end());
+		workers[t].next.clear();
+	}
+	claimed.store(0);
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void DeltaStepping::advance()
+// Title:		Moves to the next bucket
+// Description: Picks the lowest bucket any thread holds nodes for and moves
+//					them into the frontier, or ends the search if there is
+//					none. Run by thread 0 alone between barriers
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void DeltaStepping::advance()
+{
+	int lowest = INT_MAX;
+	for (int t = 0; t < threadCount; t++)
+	{
+		lowest = min(lowest, workers[t].nextBucket);
+	}
+	if (lowest == INT_MAX)
+	{
+		finished = true;
+		return;
+	}
+	bucket = lowest;
+	frontier.clear();
+	for (int t = 0; t < threadCount; t++)
+	{
+		vector<int> &held = workers[t].buckets[bucket % slots];
+		frontier.insert(frontier.end(), held.begin(), held.end());
+		held.clear();
+	}
+	claimed.store(0);
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void DeltaStepping::wait()
+// Title:		Barrier
+// Description: Blocks until every thread of the search has called wait the
+//					same number of times. The lock also makes each thread's
+//					writes before the barrier visible to all after it
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void DeltaStepping::wait()
+{
+	if (threadCount == 1)
+	{
+		return;
+	}
+	unique_lock<mutex> lock(gate);
+	unsigned round = generation;
+	if (++waiting == threadCount)
+	{
+		waiting = 0;
+		generation++;
+		turn.notify_all();
+		return;
+	}
+	while (round == generation)
+	{
+		turn.wait(lock);
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Function:	const SearchCounters &DeltaStepping::counters() const
+// Title:		Work counters
+// Description: Returns the nodes settled, edges relaxed, costs lowered and
+//					bucket entries of every search since the counters were
+//					cleared. All zero when compiled with DIJKSTRA_NO_STATS
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		const SearchCounters &; counts of this search
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+const SearchCounters &DeltaStepping::counters() const
+{
+	return work;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void DeltaStepping::clearCounters()
+// Title:		Zeroes the work counters
+// Description: Sets every count of counters back to zero
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void DeltaStepping::clearCounters()
+{
+	memset(&work, 0, sizeof(work));
+}
@@ -0,0 +1,101 @@
+#ifndef DELTASTEPPING_H
+#define DELTASTEPPING_H
+//----------------------------------------------------------------------------
+// File: deltastepping.h
+//
+// Description: Function outlines for the DeltaStepping class, a single
+//				source search shared between threads, for one search over a
+//				graph too large to wait on a single thread for. Nodes are
+//				kept in buckets of costs delta wide and the lowest bucket
+//				is emptied in rounds. Each round relaxes, in parallel, the
+//				light edges, of weight at most delta, of the nodes in the
+//				bucket, which may put nodes back into it. Once it stays
+//				empty its costs are final and the heavy edges of its nodes
+//				are relaxed once. The cost and previous node of each node
+//				share one atomic word, so a thread lowers both at once and
+//				every previous node is on a lowest cost path. A small delta
+//				settles nodes nearly in Dijkstra order with little parallel
+//				work per round, a large one gives more work per round but
+//				relaxes nodes more than once
+//
+// Programmer:	Anthony Waddell
+//
+// Environment: Hardware: PC, i7
+//              Software: OS: Windows 10
+//              Compiles under Microsoft Visual C++ 2015, g++
+//-----------------------------------------------------------------------------
+#include "csrgraph.h"
+#include "searchstats.h"
+#include <atomic>
+#include <condition_variable>
+#include <limits.h>
+#include <mutex>
+#include <stdint.h>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+class DeltaStepping
+{
+public:
+	// Constructor
+	DeltaStepping();
+
+	// Bucket width, 0 to choose one from the edges of each graph
+	void setDelta(int delta);
+	int lastDelta() const;
+
+	// Single source search with the contract of DijkstraEngine::run
+	void run(const CSRGraph &graph, int source, int threads,
+		vector<int> &dist, vector<int> &path);
+
+	// Work done since the counters were cleared
+	const SearchCounters &counters() const;
+	void clearCounters();
+
+private:
+
+	// Storage of one thread
+	struct StepWorker
+	{
+		vector<int> next;              // nodes put back in the bucket
+		vector<int> settled;           // nodes of the bucket, once each
+		vector<vector<int> > buckets;  // nodes of later buckets, cycled
+		int nextBucket;                // lowest later bucket held
+		SearchCounters work;           // counts of this thread
+	};
+
+	// Search
+	void chooseWidth(const CSRGraph &graph);
+	void worker(int id);
+	void lightRound(StepWorker &own);
+	void heavyEdges(StepWorker &own);
+	void relax(StepWorker &own, int node, int from, long long cost);
+	void gatherNext();
+	void advance();
+	void wait();
+
+	static const int CHUNK = 64;            // nodes claimed at a time
+	static const int BUCKET_LIMIT = 65536;  // most buckets kept
+
+	int delta;                            // width asked for, 0 for automatic
+	int width;                            // bucket width of the last run
+	int slots;                            // buckets kept, reused in turn
+	const CSRGraph *graph;                // graph being searched
+	vector<atomic<uint64_t> > state;      // cost << 32 | previous node
+	vector<atomic<int> > relaxedAt;       // cost light edges were relaxed at
+	vector<StepWorker> workers;           // storage of each thread
+	vector<int> frontier;                 // nodes of the current round
+	atomic<int> claimed;                  // next frontier entry not claimed
+	int bucket;                           // bucket being emptied
+	bool finished;                        // no bucket holds a node
+
+	mutex gate;                           // guards the barrier
+	condition_variable turn;              // wakes threads at the barrier
+	int threadCount;                      // threads of the running search
+	int waiting;                          // threads at the barrier
+	unsigned generation;                  // barriers passed
+	SearchCounters work;                  // counts of finished searches
+};
+#endif
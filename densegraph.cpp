@@ -0,0 +1,676 @@
+//-----------------------------------------------------------------------------
+// File:		densegraph.cpp
+// Programmer:	Anthony Waddell
+// Resources:	https://software.intel.com/sites/landingpage/IntrinsicsGuide/
+//-----------------------------------------------------------------------------
+#include "densegraph.h"
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE4_1__)
+#include <smmintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#if !defined(__AVX2__) && defined(__SSE2__)
+//-----------------------------------------------------------------------------
+// Function:	static __m128i minUnsigned(__m128i a, __m128i b)
+// Title:		Unsigned minimum of 4 lanes
+// Description: _mm_min_epu32 where SSE4.1 is available, otherwise a signed
+//					compare of both sides with the top bit flipped
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	__m128i a; first 4 values
+//				__m128i b; second 4 values
+// Returns:		__m128i; smaller value of each lane
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+static inline __m128i minUnsigned(__m128i a, __m128i b)
+{
+#if defined(__SSE4_1__)
+	return _mm_min_epu32(a, b);
+#else
+	const __m128i bias = _mm_set1_epi32((int)0x80000000u);
+	__m128i greater = _mm_cmpgt_epi32(_mm_xor_si128(a, bias),
+		_mm_xor_si128(b, bias));
+	return _mm_or_si128(_mm_and_si128(greater, b),
+		_mm_andnot_si128(greater, a));
+#endif
+}
+
+//-----------------------------------------------------------------------------
+// Function:	static __m128i choose(__m128i mask, __m128i chosen,
+//					__m128i other)
+// Title:		Selects lanes
+// Description: Takes each lane from chosen where mask is all ones and from
+//					other where it is zero
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	__m128i mask; all ones or zero per lane
+//				__m128i chosen; lanes taken where mask is set
+//				__m128i other; lanes taken where mask is clear
+// Returns:		__m128i; the selected lanes
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+static inline __m128i choose(__m128i mask, __m128i chosen, __m128i other)
+{
+#if defined(__SSE4_1__)
+	return _mm_blendv_epi8(other, chosen, mask);
+#else
+	return _mm_or_si128(_mm_and_si128(mask, chosen),
+		_mm_andnot_si128(mask, other));
+#endif
+}
+#endif
+
+#if defined(__AVX2__) || defined(__SSE2__)
+//-----------------------------------------------------------------------------
+// Function:	static int lowestBit(int mask)
+// Title:		Position of the lowest set bit
+// Description: Counts trailing zeros with the compiler builtin where there
+//					is one, otherwise by shifting, since MSVC sets __AVX2__
+//					but has no __builtin_ctz
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int mask; compare mask, never 0
+// Returns:		int; index of the lowest set bit
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+static inline int lowestBit(int mask)
+{
+#if defined(__GNUC__)
+	return __builtin_ctz((unsigned int)mask);
+#else
+	int bit = 0;
+	while ((mask & 1) == 0)
+	{
+		mask >>= 1;
+		bit++;
+	}
+	return bit;
+#endif
+}
+#endif
+
+//-----------------------------------------------------------------------------
+// Function:	DenseGraph::DenseGraph()
+// Title:		Constructor
+// Description: Constructs an empty matrix
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		N/A
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+DenseGraph::DenseGraph()
+{
+	nodes = 0;
+	stride = 0;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void DenseGraph::build(const CSRGraph &graph)
+// Title:		Builds the matrix
+// Description: Fills a (nodes + 1) by stride matrix with INT_MAX and copies
+//					every edge of graph into it. Row padding past the last
+//					node also holds INT_MAX so vector loops can run to the
+//					end of the row
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	const CSRGraph &graph; edges to copy
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void DenseGraph::build(const CSRGraph &graph)
+{
+	nodes = graph.nodeCount();
+	stride = (nodes + 1 + 7) & ~7;
+	weights.assign((size_t)(nodes + 1) * stride, INT_MAX);
+
+	const int *offsets = graph.offsetArray();
+	const int *targets = graph.targetArray();
+	const int *costs = graph.weightArray();
+	for (int v = 1; v <= nodes; v++)
+	{
+		uint32_t *row = &weights[(size_t)v * stride];
+		for (int i = offsets[v]; i < offsets[v + 1]; i++)
+		{
+			row[targets[i]] = (uint32_t)costs[i];
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void DenseGraph::clear()
+// Title:		Empties the matrix
+// Description: Frees the matrix
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void DenseGraph::clear()
+{
+	nodes = 0;
+	stride = 0;
+	vector<uint32_t>().swap(weights);
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void DenseGraph::setWeight(int source, int destination,
+//					int weight)
+// Title:		Changes one cost
+// Description: Sets the cost of the edge from source to destination, so an
+//					edge change does not need a rebuild
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int source; subscript of the source node
+//				int destination; subscript of the destination node
+//				int weight; new cost, INT_MAX for no edge
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void DenseGraph::setWeight(int source, int destination, int weight)
+{
+	weights[(size_t)source * stride + destination] = (uint32_t)weight;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	int DenseGraph::nodeCount() const
+// Title:		Number of nodes
+// Description: Returns the number of nodes in the matrix
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		int; number of nodes
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+int DenseGraph::nodeCount() const
+{
+	return nodes;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void DenseGraph::run(int source, DenseWork &work,
+//					vector<int> &dist, vector<int> &path) const
+// Title:		Single source shortest paths
+// Description: The O(V^2) array form of Dijkstra's algorithm: settle the
+//					closest unsettled node, then relax its whole row. Costs
+//					are summed as unsigned, since two costs of at most
+//					INT_MAX can not wrap, and anything not below INT_MAX
+//					is never kept. Settled nodes need no mask during the
+//					relaxation as no cost through a later node can be lower
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int source; subscript of the source node
+//				DenseWork &work; arrays owned by the calling thread
+//				vector<int> &dist; set to the lowest cost of each node
+//				vector<int> &path; set to the previous node of each node
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void DenseGraph::run(int source, DenseWork &work, vector<int> &dist,
+	vector<int> &path) const
+{
+	dist.assign(nodes + 1, INT_MAX);
+	path.assign(nodes + 1, 0);
+	if (source < 1 || source > nodes)
+	{
+		return;
+	}
+
+	// Column 0 and the row padding count as settled so they are never picked
+	work.dist.assign(stride, INT_MAX);
+	work.path.assign(stride, 0);
+	work.done.assign(stride, 0xFFFFFFFFu);
+	fill(work.done.begin() + 1, work.done.begin() + nodes + 1, 0u);
+	work.dist[source] = 0;
+
+	int v = 0;
+	while ((v = closest(work, stride)) > 0)
+	{
+		work.done[v] = 0xFFFFFFFFu;
+		relaxRow(&weights[(size_t)v * stride], work.dist[v], v, work, stride);
+	}
+
+	for (int w = 1; w <= nodes; w++)
+	{
+		dist[w] = (int)work.dist[w];
+		path[w] = work.dist[w] == INT_MAX ? 0 : work.path[w];
+	}
+	path[source] = 0;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void DenseGraph::allPairs(vector<uint32_t> &dist,
+//					vector<int32_t> &path, int threads) const
+// Title:		All pairs shortest paths
+// Description: Floyd-Warshall over BLOCK by BLOCK tiles of the matrix, so
+//					each round works on tiles that stay in cache. Round b
+//					lets paths pass through the nodes of block b: first the
+//					tile on the diagonal, then the rest of row and column b
+//					of tiles, which only need the diagonal, and last every
+//					other tile, which only needs row and column b, shared
+//					out between threads by row of tiles. The previous node
+//					of a path through k is the previous node of its k part
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	vector<uint32_t> &dist; set to the lowest costs, INT_MAX
+//					where no path exists
+//				vector<int32_t> &path; set to the previous nodes, 0 for
+//					a node itself and where no path exists
+//				int threads; most threads to use
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void DenseGraph::allPairs(vector<uint32_t> &dist, vector<int32_t> &path,
+	int threads) const
+{
+	// Start from the edges, each node reaching itself at no cost
+	dist = weights;
+	path.assign(weights.size(), 0);
+	for (int i = 1; i <= nodes; i++)
+	{
+		size_t row = (size_t)i * stride;
+		for (int j = 1; j <= nodes; j++)
+		{
+			path[row + j] = weights[row + j] < INT_MAX ? i : 0;
+		}
+		dist[row + i] = 0;
+		path[row + i] = 0;
+	}
+
+	FloydRound round;
+	round.dist = dist.empty() ? NULL : &dist[0];
+	round.path = path.empty() ? NULL : &path[0];
+	round.stride = stride;
+	round.nodes = nodes;
+	int blocks = (nodes + BLOCK - 1) / BLOCK;
+	threads = max(1, min(threads, blocks - 1));
+	for (int b = 0; b < blocks; b++)
+	{
+		round.block = b;
+
+		// Diagonal tile, then the rest of its row and column of tiles
+		relaxBlock(round, b, b);
+		for (int other = 0; other < blocks; other++)
+		{
+			if (other != b)
+			{
+				relaxBlock(round, b, other);
+				relaxBlock(round, other, b);
+			}
+		}
+
+		// Every remaining tile, one row of tiles at a time
+		round.next = 0;
+		if (threads <= 1)
+		{
+			roundWorker(&round);
+			continue;
+		}
+		vector<thread> workers;
+		for (int t = 0; t < threads; t++)
+		{
+			workers.push_back(thread(&DenseGraph::roundWorker, &round));
+		}
+		for (int t = 0; t < threads; t++)
+		{
+			workers[t].join();
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Function:	int DenseGraph::rowLength() const
+// Title:		Row length
+// Description: Returns the distance between rows of the matrices allPairs
+//					fills, at least nodeCount() + 1
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		int; row length
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+int DenseGraph::rowLength() const
+{
+	return stride;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void DenseGraph::roundWorker(FloydRound *round)
+// Title:		Floyd-Warshall worker
+// Description: Claims rows of tiles until none are left and relaxes every
+//					tile of each that is not in the round's row or column
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	FloydRound *round; round being solved
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void DenseGraph::roundWorker(FloydRound *round)
+{
+	int blocks = (round->nodes + BLOCK - 1) / BLOCK;
+	int rowBlock = 0;
+	while ((rowBlock = round->next.fetch_add(1)) < blocks)
+	{
+		if (rowBlock == round->block)
+		{
+			continue;
+		}
+		for (int columnBlock = 0; columnBlock < blocks; columnBlock++)
+		{
+			if (columnBlock != round->block)
+			{
+				relaxBlock(*round, rowBlock, columnBlock);
+			}
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void DenseGraph::relaxBlock(FloydRound &round, int rowBlock,
+//					int columnBlock)
+// Title:		Relaxes one tile
+// Description: Lets the paths of one tile pass through each node of the
+//					round's block in turn. Costs from a node never change in
+//					the step for that node, as its own cost is 0, so the
+//					tile can be updated in place
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	FloydRound &round; round being solved
+//				int rowBlock; block of the path sources
+//				int columnBlock; block of the path destinations
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void DenseGraph::relaxBlock(FloydRound &round, int rowBlock, int columnBlock)
+{
+	int k0 = 1 + round.block * BLOCK;
+	int k1 = min(k0 + BLOCK, round.nodes + 1);
+	int i0 = 1 + rowBlock * BLOCK;
+	int i1 = min(i0 + BLOCK, round.nodes + 1);
+	int j0 = 1 + columnBlock * BLOCK;
+	int j1 = min(j0 + BLOCK, round.nodes + 1);
+	for (int k = k0; k < k1; k++)
+	{
+		const uint32_t *through = round.dist + (size_t)k * round.stride;
+		const int32_t *throughPath = round.path + (size_t)k * round.stride;
+		for (int i = i0; i < i1; i++)
+		{
+			uint32_t *dist = round.dist + (size_t)i * round.stride;
+			if (dist[k] >= INT_MAX)
+			{
+				continue;
+			}
+			relaxSpan(through, throughPath, dist[k], dist,
+				round.path + (size_t)i * round.stride, j0, j1);
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void DenseGraph::relaxSpan(const uint32_t *through,
+//					const int32_t *throughPath, uint32_t cost,
+//					uint32_t *dist, int32_t *path, int from, int to)
+// Title:		Relaxes part of a row through one node
+// Description: For columns from to to sets dist to min(dist, cost + through)
+//					and takes the previous node from throughPath where dist
+//					went down, with no branches
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	const uint32_t *through; costs from the node passed through
+//				const int32_t *throughPath; its previous nodes
+//				uint32_t cost; cost of reaching that node
+//				uint32_t *dist; costs of the row
+//				int32_t *path; previous nodes of the row
+//				int from; first column
+//				int to; column after the last
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void DenseGraph::relaxSpan(const uint32_t *through,
+	const int32_t *throughPath, uint32_t cost, uint32_t *dist, int32_t *path,
+	int from, int to)
+{
+	int c = from;
+#if defined(__AVX2__)
+	const __m256i costs = _mm256_set1_epi32((int)cost);
+	for (; c + 8 <= to; c += 8)
+	{
+		__m256i sum = _mm256_add_epi32(costs,
+			_mm256_loadu_si256((const __m256i *)(through + c)));
+		__m256i old = _mm256_loadu_si256((const __m256i *)(dist + c));
+		__m256i best = _mm256_min_epu32(sum, old);
+		__m256i kept = _mm256_cmpeq_epi32(best, old);
+		_mm256_storeu_si256((__m256i *)(dist + c), best);
+		_mm256_storeu_si256((__m256i *)(path + c), _mm256_blendv_epi8(
+			_mm256_loadu_si256((const __m256i *)(throughPath + c)),
+			_mm256_loadu_si256((const __m256i *)(path + c)), kept));
+	}
+#elif defined(__SSE2__)
+	const __m128i costs = _mm_set1_epi32((int)cost);
+	for (; c + 4 <= to; c += 4)
+	{
+		__m128i sum = _mm_add_epi32(costs,
+			_mm_loadu_si128((const __m128i *)(through + c)));
+		__m128i old = _mm_loadu_si128((const __m128i *)(dist + c));
+		__m128i best = minUnsigned(sum, old);
+		__m128i kept = _mm_cmpeq_epi32(best, old);
+		_mm_storeu_si128((__m128i *)(dist + c), best);
+		_mm_storeu_si128((__m128i *)(path + c), choose(kept,
+			_mm_loadu_si128((const __m128i *)(path + c)),
+			_mm_loadu_si128((const __m128i *)(throughPath + c))));
+	}
+#endif
+	for (; c < to; c++)
+	{
+		uint32_t sum = cost + through[c];
+		bool lower = sum < dist[c];
+		dist[c] = lower ? sum : dist[c];
+		path[c] = lower ? throughPath[c] : path[c];
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Function:	const char *DenseGraph::kernel()
+// Title:		Compiled kernel
+// Description: Names the vector instructions the kernels were built with
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		const char *; "avx2", "sse4.1", "sse2" or "scalar"
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+const char *DenseGraph::kernel()
+{
+#if defined(__AVX2__)
+	return "avx2";
+#elif defined(__SSE4_1__)
+	return "sse4.1";
+#elif defined(__SSE2__)
+	return "sse2";
+#else
+	return "scalar";
+#endif
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void DenseGraph::relaxRow(const uint32_t *row, uint32_t cost,
+//					int node, DenseWork &work, int stride)
+// Title:		Relaxes one row
+// Description: For every column sets dist to min(dist, cost + row) and the
+//					previous node to node where dist went down, with no
+//					branches
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	const uint32_t *row; costs of the edges leaving node
+//				uint32_t cost; lowest cost of node
+//				int node; subscript of the node just settled
+//				DenseWork &work; arrays of the search
+//				int stride; row length
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void DenseGraph::relaxRow(const uint32_t *row, uint32_t cost, int node,
+	DenseWork &work, int stride)
+{
+	uint32_t *dist = &work.dist[0];
+	int32_t *path = &work.path[0];
+	int c = 0;
+#if defined(__AVX2__)
+	const __m256i costs = _mm256_set1_epi32((int)cost);
+	const __m256i from = _mm256_set1_epi32(node);
+	for (; c + 8 <= stride; c += 8)
+	{
+		__m256i through = _mm256_add_epi32(costs,
+			_mm256_loadu_si256((const __m256i *)(row + c)));
+		__m256i old = _mm256_loadu_si256((const __m256i *)(dist + c));
+		__m256i best = _mm256_min_epu32(through, old);
+		__m256i kept = _mm256_cmpeq_epi32(best, old);
+		__m256i previous = _mm256_loadu_si256((const __m256i *)(path + c));
+		_mm256_storeu_si256((__m256i *)(dist + c), best);
+		_mm256_storeu_si256((__m256i *)(path + c),
+			_mm256_blendv_epi8(from, previous, kept));
+	}
+#elif defined(__SSE2__)
+	const __m128i costs = _mm_set1_epi32((int)cost);
+	const __m128i from = _mm_set1_epi32(node);
+	for (; c + 4 <= stride; c += 4)
+	{
+		__m128i through = _mm_add_epi32(costs,
+			_mm_loadu_si128((const __m128i *)(row + c)));
+		__m128i old = _mm_loadu_si128((const __m128i *)(dist + c));
+		__m128i best = minUnsigned(through, old);
+		__m128i kept = _mm_cmpeq_epi32(best, old);
+		__m128i previous = _mm_loadu_si128((const __m128i *)(path + c));
+		_mm_storeu_si128((__m128i *)(dist + c), best);
+		_mm_storeu_si128((__m128i *)(path + c),
+			choose(kept, previous, from));
+	}
+#endif
+	for (; c < stride; c++)
+	{
+		uint32_t through = cost + row[c];
+		bool lower = through < dist[c];
+		dist[c] = lower ? through : dist[c];
+		path[c] = lower ? node : path[c];
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Function:	int DenseGraph::closest(const DenseWork &work, int stride)
+// Title:		Finds the closest unsettled node
+// Description: Takes the minimum of dist OR done over the row, which makes
+//					settled columns all ones, then finds the first column
+//					holding it, so ties go to the lowest subscript
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	const DenseWork &work; arrays of the search
+//				int stride; row length
+// Returns:		int; subscript of the node, 0 if no unsettled node is
+//					reachable
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Lowest bit found without GCC builtins elsewhere
+//-----------------------------------------------------------------------------
+int DenseGraph::closest(const DenseWork &work, int stride)
+{
+	const uint32_t *dist = &work.dist[0];
+	const uint32_t *done = &work.done[0];
+	uint32_t best = 0xFFFFFFFFu;
+	int c = 0;
+#if defined(__AVX2__)
+	__m256i lowest = _mm256_set1_epi32(-1);
+	for (; c + 8 <= stride; c += 8)
+	{
+		__m256i key = _mm256_or_si256(
+			_mm256_loadu_si256((const __m256i *)(dist + c)),
+			_mm256_loadu_si256((const __m256i *)(done + c)));
+		lowest = _mm256_min_epu32(lowest, key);
+	}
+	__m128i half = _mm_min_epu32(_mm256_castsi256_si128(lowest),
+		_mm256_extracti128_si256(lowest, 1));
+	half = _mm_min_epu32(half, _mm_shuffle_epi32(half, 0x4E));
+	half = _mm_min_epu32(half, _mm_shuffle_epi32(half, 0xB1));
+	best = (uint32_t)_mm_cvtsi128_si32(half);
+#elif defined(__SSE2__)
+	__m128i lowest = _mm_set1_epi32(-1);
+	for (; c + 4 <= stride; c += 4)
+	{
+		__m128i key = _mm_or_si128(
+			_mm_loadu_si128((const __m128i *)(dist + c)),
+			_mm_loadu_si128((const __m128i *)(done + c)));
+		lowest = minUnsigned(lowest, key);
+	}
+	lowest = minUnsigned(lowest, _mm_shuffle_epi32(lowest, 0x4E));
+	lowest = minUnsigned(lowest, _mm_shuffle_epi32(lowest, 0xB1));
+	best = (uint32_t)_mm_cvtsi128_si32(lowest);
+#endif
+	for (; c < stride; c++)
+	{
+		uint32_t key = dist[c] | done[c];
+		best = key < best ? key : best;
+	}
+	if (best >= INT_MAX)
+	{
+		return 0;
+	}
+
+	// First column holding the minimum
+	c = 0;
+#if defined(__AVX2__)
+	const __m256i target = _mm256_set1_epi32((int)best);
+	for (; c + 8 <= stride; c += 8)
+	{
+		__m256i key = _mm256_or_si256(
+			_mm256_loadu_si256((const __m256i *)(dist + c)),
+			_mm256_loadu_si256((const __m256i *)(done + c)));
+		int mask = _mm256_movemask_ps(_mm256_castsi256_ps(
+			_mm256_cmpeq_epi32(key, target)));
+		if (mask != 0)
+		{
+			return c + lowestBit(mask);
+		}
+	}
+#elif defined(__SSE2__)
+	const __m128i target = _mm_set1_epi32((int)best);
+	for (; c + 4 <= stride; c += 4)
+	{
+		__m128i key = _mm_or_si128(
+			_mm_loadu_si128((const __m128i *)(dist + c)),
+			_mm_loadu_si128((const __m128i *)(done + c)));
+		int mask = _mm_movemask_ps(_mm_castsi128_ps(
+			_mm_cmpeq_epi32(key, target)));
+		if (mask != 0)
+		{
+			return c + lowestBit(mask);
+		}
+	}
+#endif
+	for (; c < stride; c++)
+	{
+		if ((dist[c] | done[c]) == best)
+		{
+			return c;
+		}
+	}
+	return 0;
+}
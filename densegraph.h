@@ -0,0 +1,91 @@
+#ifndef DENSEGRAPH_H
+#define DENSEGRAPH_H
+//----------------------------------------------------------------------------
+// File: densegraph.h
+//
+// Description: Function outlines for the DenseGraph class, a cost matrix
+//				for graphs with edges between most pairs of nodes. Single
+//				source searches over it scan whole rows instead of edge
+//				lists, with distances, previous nodes and settled flags
+//				kept as separate arrays so the row relaxation and the
+//				search for the closest unsettled node run as AVX2, SSE4.1
+//				or SSE2 vector loops. Other targets use the same loops in
+//				scalar code. All pairs can also be solved at once by a cache
+//				blocked Floyd-Warshall built on the same loops
+//
+// Programmer:	Anthony Waddell
+//
+// Environment: Hardware: PC, i7
+//              Software: OS: Windows 10
+//              Compiles under Microsoft Visual C++ 2015, g++
+//-----------------------------------------------------------------------------
+#include "csrgraph.h"
+#include <atomic>
+#include <limits.h>
+#include <stdint.h>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+// Working arrays of one search, one per thread, each one row long
+struct DenseWork
+{
+	vector<uint32_t> dist;     // lowest cost found, INT_MAX if none
+	vector<int32_t> path;      // previous node on the lowest cost path
+	vector<uint32_t> done;     // all ones once settled or not a node
+};
+
+class DenseGraph
+{
+public:
+	// Constructor
+	DenseGraph();
+
+	// Copy the edges of graph into the matrix, removed edges are left out
+	void build(const CSRGraph &graph);
+	void clear();
+	void setWeight(int source, int destination, int weight);
+	int nodeCount() const;
+
+	// Single source search with the contract of DijkstraEngine::run
+	void run(int source, DenseWork &work, vector<int> &dist,
+		vector<int> &path) const;
+
+	// All pairs at once, row i of dist and path is rowLength() long and
+	// holds the costs and previous nodes from node i
+	void allPairs(vector<uint32_t> &dist, vector<int32_t> &path,
+		int threads) const;
+	int rowLength() const;
+
+	// Vector instructions compiled in, "avx2", "sse4.1", "sse2" or "scalar"
+	static const char *kernel();
+
+private:
+
+	// One round of blocked Floyd-Warshall, shared by its worker threads
+	struct FloydRound
+	{
+		uint32_t *dist;        // cost matrix being solved
+		int32_t *path;         // previous node matrix being solved
+		int stride;            // row length
+		int nodes;             // last node
+		int block;             // block of the round's through nodes
+		atomic<int> next;      // next row block not yet claimed
+	};
+
+	static const int BLOCK = 64;          // nodes per side of a block
+
+	static void relaxSpan(const uint32_t *through, const int32_t *throughPath,
+		uint32_t cost, uint32_t *dist, int32_t *path, int from, int to);
+	static void relaxBlock(FloydRound &round, int rowBlock, int columnBlock);
+	static void roundWorker(FloydRound *round);
+	static void relaxRow(const uint32_t *row, uint32_t cost, int node,
+		DenseWork &work, int stride);
+	static int closest(const DenseWork &work, int stride);
+
+	int nodes;                            // number of nodes, index 0 unused
+	int stride;                           // row length, a multiple of 8
+	vector<uint32_t> weights;             // nodes + 1 rows, INT_MAX if none
+};
+#endif
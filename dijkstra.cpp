@@ -0,0 +1,630 @@
+//-----------------------------------------------------------------------------
+// File:		dijkstra.cpp
+// Programmer:	Anthony Waddell
+// Resources:	For search
+//					https://en.wikipedia.org/wiki/Dijkstra%27s_algorithm
+//-----------------------------------------------------------------------------
+#include "dijkstra.h"
+#include <string.h>
+
+//-----------------------------------------------------------------------------
+// Function:	DijkstraEngine::DijkstraEngine(HeapType heapType)
+// Title:		Constructor
+// Description: Constructs an engine that uses the given priority queue. The
+//					engine keeps its heaps between runs so repeated searches
+//					do not allocate once the heaps have grown
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	HeapType heapType; priority queue to use
+// Returns:		N/A
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Clears the counters
+//-----------------------------------------------------------------------------
+DijkstraEngine::DijkstraEngine(HeapType heapType)
+{
+	this->heapType = heapType;
+	clearCounters();
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void DijkstraEngine::run(const CSRGraph &graph,
+//					int source, vector<int> &dist, vector<int> &path)
+// Title:		Single source shortest paths
+// Description: Finds the lowest cost from source to every node of graph.
+//					Unreachable nodes are left with distance INT_MAX. The
+//					path entry of a node is the previous node on its lowest
+//					cost path, 0 for the source and unreachable nodes
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	const CSRGraph &graph; edges of each node
+//				int source; subscript of the source node
+//				vector<int> &dist; set to the lowest cost of each node
+//				vector<int> &path; set to the previous node of each node
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void DijkstraEngine::run(const CSRGraph &graph, int source,
+	vector<int> &dist, vector<int> &path)
+{
+	if (heapType == RADIX_HEAP)
+	{
+		search(radixHeap, graph, source, dist, path);
+	}
+	else
+	{
+		search(binaryHeap, graph, source, dist, path);
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void DijkstraEngine::search(Heap &heap,
+//					const CSRGraph &graph, int source,
+//					vector<int> &dist, vector<int> &path)
+// Title:		Search loop
+// Description: Pops the lowest cost vertex, skipping entries that are stale
+//					because a lower cost was found after they were pushed,
+//					and relaxes each of its outgoing edges. Each edge is
+//					looked at once, so a search costs O((V + E) log V).
+//					Edges of a vertex are a sequential scan of the packed
+//					target and weight arrays
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	Heap &heap; empty or reusable priority queue
+//				const CSRGraph &graph; edges of each node
+//				int source; subscript of the source node
+//				vector<int> &dist; set to the lowest cost of each node
+//				vector<int> &path; set to the previous node of each node
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Counts its work
+//-----------------------------------------------------------------------------
+template <class Heap>
+void DijkstraEngine::search(Heap &heap, const CSRGraph &graph,
+	int source, vector<int> &dist, vector<int> &path)
+{
+	const int *offsets = graph.offsetArray();
+	const int *targets = graph.targetArray();
+	const int *weights = graph.weightArray();
+
+	dist.assign(graph.nodeCount() + 1, INT_MAX);
+	path.assign(graph.nodeCount() + 1, 0);
+	heap.clear();
+
+	dist[source] = 0;
+	heap.push(0, source);
+	SEARCH_COUNT(work.pushes++);
+
+	int d = 0;
+	int v = 0;
+	while (heap.pop(d, v))
+	{
+		SEARCH_COUNT(work.pops++);
+		// Already settled with a lower cost
+		if (d > dist[v])
+		{
+			continue;
+		}
+		SEARCH_COUNT(work.settled++);
+		// Relax all edges leaving v, skipping removed edges
+		for (int i = offsets[v]; i < offsets[v + 1]; i++)
+		{
+			if (weights[i] == INT_MAX)
+			{
+				continue;
+			}
+			SEARCH_COUNT(work.relaxed++);
+			int w = targets[i];
+			long long cost = (long long)d + weights[i];
+			if (cost < dist[w])
+			{
+				dist[w] = (int)cost;
+				path[w] = v;
+				heap.push(dist[w], w);
+				SEARCH_COUNT(work.decreased++);
+				SEARCH_COUNT(work.pushes++);
+			}
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Function:	int DijkstraEngine::query(const CSRGraph &graph, int source,
+//					int target, vector<int> &nodes)
+// Title:		Point to point search
+// Description: Searches from source only until target is settled, so nodes
+//					further away than target are never looked at. Only the
+//					nodes reached are reset for the next query
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	const CSRGraph &graph; edges of each node
+//				int source; subscript of the source node
+//				int target; subscript of the destination node
+//				vector<int> &nodes; set to the path, empty if none
+// Returns:		int; lowest cost, INT_MAX if target is unreachable
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+int DijkstraEngine::query(const CSRGraph &graph, int source, int target,
+	vector<int> &nodes)
+{
+	prepare(graph.nodeCount());
+	if (heapType == RADIX_HEAP)
+	{
+		searchTo(radixHeap, graph, source, &target, 1);
+	}
+	else
+	{
+		searchTo(binaryHeap, graph, source, &target, 1);
+	}
+	return pathTo(target, &nodes);
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void DijkstraEngine::queryTargets(const CSRGraph &graph,
+//					int source, const vector<int> &targets)
+// Title:		One to many search
+// Description: Searches from source only until every node of targets is
+//					settled, so a group of queries from one source costs one
+//					search out to its furthest target
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	const CSRGraph &graph; edges of each node
+//				int source; subscript of the source node
+//				const vector<int> &targets; subscripts of the destinations,
+//					repeats allowed
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void DijkstraEngine::queryTargets(const CSRGraph &graph, int source,
+	const vector<int> &targets)
+{
+	prepare(graph.nodeCount());
+	if (targets.empty())
+	{
+		return;
+	}
+	if (heapType == RADIX_HEAP)
+	{
+		searchTo(radixHeap, graph, source, &targets[0], (int)targets.size());
+	}
+	else
+	{
+		searchTo(binaryHeap, graph, source, &targets[0], (int)targets.size());
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Function:	int DijkstraEngine::pathTo(int target,
+//					vector<int> *nodes) const
+// Title:		Result of the last point to point search
+// Description: Returns the cost of target found by the last query or
+//					queryTargets, which must have included target, and walks
+//					its path back to the source
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int target; subscript of the destination node
+//				vector<int> *nodes; set to the path, empty if none, may
+//					be NULL when only the cost is wanted
+// Returns:		int; lowest cost, INT_MAX if target is unreachable
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+int DijkstraEngine::pathTo(int target, vector<int> *nodes) const
+{
+	int cost = forwardDist[target];
+	if (nodes == NULL)
+	{
+		return cost;
+	}
+	nodes->clear();
+	if (cost != INT_MAX)
+	{
+		// Walk back from target to source, then put in source first order
+		for (int v = target; v != 0; v = forwardPath[v])
+		{
+			nodes->push_back(v);
+		}
+		reverse(nodes->begin(), nodes->end());
+	}
+	return cost;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void DijkstraEngine::searchTo(Heap &heap,
+//					const CSRGraph &graph, int source, const int *targets,
+//					int count)
+// Title:		Point to point search loop
+// Description: Same loop as search, on the engine's own storage, leaving
+//					as soon as every target is popped with its final cost
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	Heap &heap; reusable priority queue
+//				const CSRGraph &graph; edges of each node
+//				int source; subscript of the source node
+//				const int *targets; subscripts of the destination nodes
+//				int count; number of targets
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Stops after a set of targets
+//				10/17/26 AW Counts its work
+//-----------------------------------------------------------------------------
+template <class Heap>
+void DijkstraEngine::searchTo(Heap &heap, const CSRGraph &graph, int source,
+	const int *targets, int count)
+{
+	const int *offsets = graph.offsetArray();
+	const int *edgeTargets = graph.targetArray();
+	const int *weights = graph.weightArray();
+
+	// Flag each distinct target, the search ends when none are left
+	int remaining = 0;
+	for (int i = 0; i < count; i++)
+	{
+		if (!wanted[targets[i]])
+		{
+			wanted[targets[i]] = 1;
+			remaining++;
+		}
+	}
+
+	heap.clear();
+	reach(forwardDist, source, 0);
+	heap.push(0, source);
+	SEARCH_COUNT(work.pushes++);
+
+	int d = 0;
+	int v = 0;
+	while (heap.pop(d, v))
+	{
+		SEARCH_COUNT(work.pops++);
+		if (d > forwardDist[v])
+		{
+			continue;
+		}
+		SEARCH_COUNT(work.settled++);
+		// Target settled, its cost can not go down any further
+		if (wanted[v])
+		{
+			wanted[v] = 0;
+			if (--remaining == 0)
+			{
+				break;
+			}
+		}
+		for (int i = offsets[v]; i < offsets[v + 1]; i++)
+		{
+			if (weights[i] == INT_MAX)
+			{
+				continue;
+			}
+			SEARCH_COUNT(work.relaxed++);
+			int w = edgeTargets[i];
+			long long cost = (long long)d + weights[i];
+			if (cost < forwardDist[w])
+			{
+				reach(forwardDist, w, (int)cost);
+				forwardPath[w] = v;
+				heap.push((int)cost, w);
+				SEARCH_COUNT(work.decreased++);
+				SEARCH_COUNT(work.pushes++);
+			}
+		}
+	}
+
+	// Unreachable targets are still flagged
+	for (int i = 0; i < count && remaining > 0; i++)
+	{
+		if (wanted[targets[i]])
+		{
+			wanted[targets[i]] = 0;
+			remaining--;
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Function:	int DijkstraEngine::queryBidirectional(
+//					const CSRGraph &forward, const CSRGraph &backward,
+//					int source, int target, vector<int> &nodes)
+// Title:		Bidirectional point to point search
+// Description: Grows one search forward from source and one backward from
+//					target over the reversed edges, always advancing the side
+//					with the smaller next cost. Every edge scanned that joins
+//					the two searches is a candidate path. Stops once the two
+//					smallest queued costs add up to at least the best
+//					candidate, since no later meeting can be cheaper
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	const CSRGraph &forward; edges of each node
+//				const CSRGraph &backward; forward with every edge reversed
+//				int source; subscript of the source node
+//				int target; subscript of the destination node
+//				vector<int> &nodes; set to the path, empty if none
+// Returns:		int; lowest cost, INT_MAX if target is unreachable
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Counts its work
+//-----------------------------------------------------------------------------
+int DijkstraEngine::queryBidirectional(const CSRGraph &forward,
+	const CSRGraph &backward, int source, int target, vector<int> &nodes)
+{
+	prepare(forward.nodeCount());
+	nodes.clear();
+	binaryHeap.clear();
+	backwardHeap.clear();
+
+	long long best = INT_MAX;
+	int meet = 0;
+	reach(forwardDist, source, 0);
+	reach(backwardDist, target, 0);
+	binaryHeap.push(0, source);
+	backwardHeap.push(0, target);
+	SEARCH_COUNT(work.pushes += 2);
+	if (source == target)
+	{
+		best = 0;
+		meet = source;
+	}
+
+	while (!binaryHeap.empty() && !backwardHeap.empty())
+	{
+		if ((long long)binaryHeap.topKey() + backwardHeap.topKey() >= best)
+		{
+			break;
+		}
+
+		// Advance the side whose next node is closer
+		bool isForward = binaryHeap.topKey() <= backwardHeap.topKey();
+		BinaryHeap &heap = isForward ? binaryHeap : backwardHeap;
+		const CSRGraph &graph = isForward ? forward : backward;
+		vector<int> &dist = isForward ? forwardDist : backwardDist;
+		vector<int> &path = isForward ? forwardPath : backwardPath;
+		vector<int> &other = isForward ? backwardDist : forwardDist;
+
+		int d = 0;
+		int v = 0;
+		heap.pop(d, v);
+		SEARCH_COUNT(work.pops++);
+		if (d > dist[v])
+		{
+			continue;
+		}
+		SEARCH_COUNT(work.settled++);
+
+		const int *offsets = graph.offsetArray();
+		const int *targets = graph.targetArray();
+		const int *weights = graph.weightArray();
+		for (int i = offsets[v]; i < offsets[v + 1]; i++)
+		{
+			if (weights[i] == INT_MAX)
+			{
+				continue;
+			}
+			SEARCH_COUNT(work.relaxed++);
+			int w = targets[i];
+			long long cost = (long long)d + weights[i];
+			if (cost < dist[w])
+			{
+				reach(dist, w, (int)cost);
+				path[w] = v;
+				heap.push((int)cost, w);
+				SEARCH_COUNT(work.decreased++);
+				SEARCH_COUNT(work.pushes++);
+			}
+			// Edge joins both searches
+			if (other[w] != INT_MAX && cost + other[w] < best)
+			{
+				best = cost + other[w];
+				meet = w;
+			}
+		}
+	}
+
+	if (meet == 0)
+	{
+		return INT_MAX;
+	}
+	for (int v = meet; v != 0; v = forwardPath[v])
+	{
+		nodes.push_back(v);
+	}
+	reverse(nodes.begin(), nodes.end());
+	for (int v = backwardPath[meet]; v != 0; v = backwardPath[v])
+	{
+		nodes.push_back(v);
+	}
+	return (int)best;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	int DijkstraEngine::queryLandmarks(const CSRGraph &graph,
+//					const LandmarkIndex &landmarks, int source, int target,
+//					vector<int> &nodes)
+// Title:		A* point to point search
+// Description: Same search as query, but the heap is keyed on the cost so
+//					far plus the landmark bound on the cost still to go, so
+//					nodes leading away from target wait behind nodes leading
+//					toward it and far fewer are settled. The bound of a node
+//					is found once, when the node is first reached, and nodes
+//					that can not reach target are never queued. Gives the
+//					same costs as query
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	const CSRGraph &graph; edges of each node
+//				const LandmarkIndex &landmarks; bounds built on graph, or
+//					on graph before some edges got dearer
+//				int source; subscript of the source node
+//				int target; subscript of the destination node
+//				vector<int> &nodes; set to the path, empty if none
+// Returns:		int; lowest cost, INT_MAX if target is unreachable
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+int DijkstraEngine::queryLandmarks(const CSRGraph &graph,
+	const LandmarkIndex &landmarks, int source, int target,
+	vector<int> &nodes)
+{
+	const int *offsets = graph.offsetArray();
+	const int *targets = graph.targetArray();
+	const int *weights = graph.weightArray();
+
+	prepare(graph.nodeCount());
+	nodes.clear();
+	binaryHeap.clear();
+	estimate[source] = landmarks.bound(source, target);
+	if (estimate[source] == INT_MAX)
+	{
+		return INT_MAX;
+	}
+	reach(forwardDist, source, 0);
+	binaryHeap.push(estimate[source], source);
+	SEARCH_COUNT(work.pushes++);
+
+	int key = 0;
+	int v = 0;
+	while (binaryHeap.pop(key, v))
+	{
+		SEARCH_COUNT(work.pops++);
+		// Queued again since with a lower cost
+		if (key > min((long long)forwardDist[v] + estimate[v],
+			(long long)INT_MAX - 1))
+		{
+			continue;
+		}
+		SEARCH_COUNT(work.settled++);
+		if (v == target)
+		{
+			break;
+		}
+		for (int i = offsets[v]; i < offsets[v + 1]; i++)
+		{
+			if (weights[i] == INT_MAX)
+			{
+				continue;
+			}
+			SEARCH_COUNT(work.relaxed++);
+			int w = targets[i];
+			long long cost = (long long)forwardDist[v] + weights[i];
+			if (cost >= forwardDist[w])
+			{
+				continue;
+			}
+			// First reach of w, its bound never changes after this
+			if (forwardDist[w] == INT_MAX)
+			{
+				estimate[w] = landmarks.bound(w, target);
+			}
+			reach(forwardDist, w, (int)cost);
+			forwardPath[w] = v;
+			if (estimate[w] != INT_MAX)
+			{
+				binaryHeap.push((int)min(cost + estimate[w],
+					(long long)INT_MAX - 1), w);
+				SEARCH_COUNT(work.decreased++);
+				SEARCH_COUNT(work.pushes++);
+			}
+		}
+	}
+	return pathTo(target, &nodes);
+}
+
+//-----------------------------------------------------------------------------
+// Function:	const SearchCounters &DijkstraEngine::counters() const
+// Title:		Work counters
+// Description: Returns the vertices settled, edges relaxed, costs lowered
+//					and heap operations of every search since the counters
+//					were cleared. All zero when compiled with
+//					DIJKSTRA_NO_STATS
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		const SearchCounters &; counts of this engine
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+const SearchCounters &DijkstraEngine::counters() const
+{
+	return work;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void DijkstraEngine::clearCounters()
+// Title:		Zeroes the work counters
+// Description: Sets every count of counters back to zero
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void DijkstraEngine::clearCounters()
+{
+	memset(&work, 0, sizeof(work));
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void DijkstraEngine::prepare(int nodeCount)
+// Title:		Resets point to point storage
+// Description: Sizes query storage for the graph and sets the nodes reached
+//					by the previous query back to unreached, so a query costs
+//					nothing for nodes it never reaches
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int nodeCount; number of nodes in the graph
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void DijkstraEngine::prepare(int nodeCount)
+{
+	if ((int)forwardDist.size() != nodeCount + 1)
+	{
+		forwardDist.assign(nodeCount + 1, INT_MAX);
+		forwardPath.assign(nodeCount + 1, 0);
+		backwardDist.assign(nodeCount + 1, INT_MAX);
+		backwardPath.assign(nodeCount + 1, 0);
+		wanted.assign(nodeCount + 1, 0);
+		estimate.assign(nodeCount + 1, 0);
+		touched.clear();
+		return;
+	}
+	for (size_t i = 0; i < touched.size(); i++)
+	{
+		int v = touched[i];
+		forwardDist[v] = INT_MAX;
+		forwardPath[v] = 0;
+		backwardDist[v] = INT_MAX;
+		backwardPath[v] = 0;
+	}
+	touched.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void DijkstraEngine::reach(vector<int> &dist, int node,
+//					int cost)
+// Title:		Sets a query cost
+// Description: Sets the cost of node, remembering the node the first time it
+//					is reached so prepare can reset it
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	vector<int> &dist; forwardDist or backwardDist
+//				int node; subscript of the node reached
+//				int cost; cost of reaching it
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void DijkstraEngine::reach(vector<int> &dist, int node, int cost)
+{
+	if (forwardDist[node] == INT_MAX && backwardDist[node] == INT_MAX)
+	{
+		touched.push_back(node);
+	}
+	dist[node] = cost;
+}
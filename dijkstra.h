@@ -0,0 +1,90 @@
+#ifndef DIJKSTRA_H
+#define DIJKSTRA_H
+//----------------------------------------------------------------------------
+// File: dijkstra.h
+//
+// Description: Function outlines for the DijkstraEngine class, a single
+//				source shortest path search driven by a priority queue over
+//				a CSRGraph. Each engine counts the work of its searches, so
+//				engines on different threads count without sharing
+//
+// Programmer:	Anthony Waddell
+//
+// Environment: Hardware: PC, i7
+//              Software: OS: Windows 10
+//              Compiles under Microsoft Visual C++ 2015, g++
+//-----------------------------------------------------------------------------
+#include "csrgraph.h"
+#include "landmarks.h"
+#include "pathheap.h"
+#include "searchstats.h"
+#include <limits.h>
+#include <vector>
+
+using namespace std;
+
+class DijkstraEngine
+{
+public:
+	// Priority queue used to pick the next vertex
+	enum HeapType
+	{
+		BINARY_HEAP,           // any non-negative weights
+		RADIX_HEAP             // integer weights, fastest on road graphs
+	};
+
+	// Constructor
+	DijkstraEngine(HeapType heapType = BINARY_HEAP);
+
+	// Single source search, dist and path are resized to the graph size
+	void run(const CSRGraph &graph, int source, vector<int> &dist,
+		vector<int> &path);
+
+	// Point to point searches that stop once target is settled, nodes is
+	// set to the path from source to target, returns INT_MAX if none
+	int query(const CSRGraph &graph, int source, int target,
+		vector<int> &nodes);
+	int queryBidirectional(const CSRGraph &forward, const CSRGraph &backward,
+		int source, int target, vector<int> &nodes);
+	int queryLandmarks(const CSRGraph &graph, const LandmarkIndex &landmarks,
+		int source, int target, vector<int> &nodes);
+
+	// Search that stops once every node of targets is settled, the costs
+	// and paths of the targets are then read with pathTo
+	void queryTargets(const CSRGraph &graph, int source,
+		const vector<int> &targets);
+	int pathTo(int target, vector<int> *nodes) const;
+
+	// Work done by every search since the counters were cleared
+	const SearchCounters &counters() const;
+	void clearCounters();
+
+private:
+
+	// Search loop shared by both heap types
+	template <class Heap>
+	void search(Heap &heap, const CSRGraph &graph, int source,
+		vector<int> &dist, vector<int> &path);
+	template <class Heap>
+	void searchTo(Heap &heap, const CSRGraph &graph, int source,
+		const int *targets, int count);
+
+	// Point to point storage
+	void prepare(int nodeCount);
+	void reach(vector<int> &dist, int node, int cost);
+
+	HeapType heapType;                    // heap used by run
+	BinaryHeap binaryHeap;                // reused between runs
+	RadixHeap radixHeap;                  // reused between runs
+	BinaryHeap backwardHeap;              // second heap of bidirectional query
+
+	vector<int> forwardDist;              // query costs from source
+	vector<int> forwardPath;              // previous node toward source
+	vector<int> backwardDist;             // query costs to target
+	vector<int> backwardPath;             // next node toward target
+	vector<int> touched;                  // nodes given a cost by last query
+	vector<char> wanted;                  // targets not yet settled
+	vector<int> estimate;                 // landmark bound of nodes reached
+	SearchCounters work;                  // counts of settles, relaxations
+};
+#endif
\ No newline at end of file
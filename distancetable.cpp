@@ -0,0 +1,573 @@
+//-----------------------------------------------------------------------------
+// File:		distancetable.cpp
+// Programmer:	Anthony Waddell
+// Resources:	N/A
+//-----------------------------------------------------------------------------
+#include "distancetable.h"
+
+// Storage for the constant, assign takes it by reference
+const uint16_t DistanceTable::NARROW_NONE;
+
+//-----------------------------------------------------------------------------
+// Function:	DistanceTable::DistanceTable()
+// Title:		Constructor
+// Description: Constructs an empty table
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		N/A
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+DistanceTable::DistanceTable()
+{
+	nodes = 0;
+	wide = false;
+	owned = true;
+	narrowData = NULL;
+	fullData = NULL;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void DistanceTable::reset(int nodes, long long maxDistance)
+// Title:		Sizes the table
+// Description: Sizes the table for nodes nodes with index 0 not being used,
+//					every cost infinite and no previous node rows. Costs are
+//					kept in 16 bits when maxDistance is below the 16 bit
+//					marker for no path, and in 32 bits otherwise
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int nodes; number of nodes in the graph
+//				long long maxDistance; highest cost any path can have
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Owns its arrays
+//-----------------------------------------------------------------------------
+void DistanceTable::reset(int nodes, long long maxDistance)
+{
+	clear();
+	this->nodes = nodes > 0 ? nodes : 0;
+	wide = maxDistance >= NARROW_NONE;
+	size_t cells = (size_t)(this->nodes + 1) * (this->nodes + 1);
+	if (wide)
+	{
+		full.assign(cells, INT_MAX);
+	}
+	else
+	{
+		narrow.assign(cells, NARROW_NONE);
+	}
+	paths.resize(this->nodes + 1);
+	pathData.assign(this->nodes + 1, NULL);
+	point();
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void DistanceTable::clear()
+// Title:		Empties the table
+// Description: Releases all costs and previous node rows, or lets go of
+//					attached ones
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Lets go of attached arrays
+//-----------------------------------------------------------------------------
+void DistanceTable::clear()
+{
+	nodes = 0;
+	wide = false;
+	vector<uint16_t>().swap(narrow);
+	vector<int>().swap(full);
+	vector<vector<int> >().swap(paths);
+	vector<const int *>().swap(pathData);
+	owned = true;
+	narrowData = NULL;
+	fullData = NULL;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	bool DistanceTable::empty() const
+// Title:		Table not sized
+// Description: Returns whether reset has not been called since the last
+//					clear
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		bool; true if the table holds no costs
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Counts attached costs
+//-----------------------------------------------------------------------------
+bool DistanceTable::empty() const
+{
+	return narrowData == NULL && fullData == NULL;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	int DistanceTable::nodeCount() const
+// Title:		Number of nodes
+// Description: Returns the number of nodes the table was sized for
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		int; number of nodes
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+int DistanceTable::nodeCount() const
+{
+	return nodes;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void DistanceTable::attach(int nodes, bool wide,
+//					const void *costs)
+// Title:		Uses costs in place
+// Description: Makes the table read costs owned elsewhere without copying
+//					them, with no previous node rows until attachPaths. A
+//					change copies the costs, or the one previous node row it
+//					writes, into the table first, so the attached memory is
+//					never written
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int nodes; number of nodes in the graph
+//				bool wide; costs are 32 bit, INT_MAX if none, instead of
+//					16 bit, 0xFFFF if none
+//				const void *costs; (nodes + 1)^2 costs in row order
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void DistanceTable::attach(int nodes, bool wide, const void *costs)
+{
+	clear();
+	this->nodes = nodes > 0 ? nodes : 0;
+	this->wide = wide;
+	owned = false;
+	narrowData = wide ? NULL : (const uint16_t *)costs;
+	fullData = wide ? (const int *)costs : NULL;
+	paths.resize(this->nodes + 1);
+	pathData.assign(this->nodes + 1, NULL);
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void DistanceTable::attachPaths(int row, const int *path)
+// Title:		Uses a previous node row in place
+// Description: Makes row read its previous nodes from memory owned
+//					elsewhere. Only valid after attach
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int row; array index of the source node
+//				const int *path; nodes + 1 previous nodes
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void DistanceTable::attachPaths(int row, const int *path)
+{
+	pathData[row] = path;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void DistanceTable::point()
+// Title:		Uses owned arrays
+// Description: Points the costs in use at the owned vectors, called after
+//					anything that may have moved them
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void DistanceTable::point()
+{
+	owned = true;
+	narrowData = narrow.empty() ? NULL : &narrow[0];
+	fullData = full.empty() ? NULL : &full[0];
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void DistanceTable::own()
+// Title:		Copies attached arrays
+// Description: Copies attached costs and previous node rows into the table.
+//					Each change copies what it writes first, costs or one
+//					previous node row, but rows stored from several threads
+//					need everything copied beforehand on one
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void DistanceTable::own()
+{
+	ownCosts();
+	for (int row = 0; row < (int)pathData.size(); row++)
+	{
+		ownPaths(row);
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void DistanceTable::ownCosts()
+// Title:		Copies attached costs
+// Description: Copies attached costs into owned vectors before a change
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void DistanceTable::ownCosts()
+{
+	if (owned)
+	{
+		return;
+	}
+	size_t cells = (size_t)(nodes + 1) * (nodes + 1);
+	if (wide)
+	{
+		full.assign(fullData, fullData + cells);
+	}
+	else
+	{
+		narrow.assign(narrowData, narrowData + cells);
+	}
+	point();
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void DistanceTable::ownPaths(int row)
+// Title:		Copies an attached previous node row
+// Description: Copies the previous node row of row into an owned vector
+//					before a change, if it is attached
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int row; array index of the source node
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void DistanceTable::ownPaths(int row)
+{
+	if (pathData[row] == NULL || !paths[row].empty())
+	{
+		return;
+	}
+	paths[row].assign(pathData[row], pathData[row] + nodes + 1);
+	pathData[row] = &paths[row][0];
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void DistanceTable::fit(long long maxDistance)
+// Title:		Widens the costs
+// Description: Copies 16 bit costs into 32 bit storage when maxDistance no
+//					longer fits in 16 bits, so an edge change that allows
+//					longer paths never truncates a cost. Costs never narrow
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	long long maxDistance; highest cost any path can now have
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Copies attached arrays first
+//-----------------------------------------------------------------------------
+void DistanceTable::fit(long long maxDistance)
+{
+	if (wide || empty() || maxDistance < NARROW_NONE)
+	{
+		return;
+	}
+	ownCosts();
+	full.resize(narrow.size());
+	for (size_t i = 0; i < narrow.size(); i++)
+	{
+		full[i] = (narrow[i] == NARROW_NONE) ? INT_MAX : narrow[i];
+	}
+	vector<uint16_t>().swap(narrow);
+	wide = true;
+	point();
+}
+
+//-----------------------------------------------------------------------------
+// Function:	bool DistanceTable::isWide() const
+// Title:		Cost width
+// Description: Returns whether costs are kept in 32 bits
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		bool; true for 32 bit costs, false for 16 bit
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+bool DistanceTable::isWide() const
+{
+	return wide;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	const void *DistanceTable::costArray() const
+// Title:		Costs in use
+// Description: Returns the cost array, 16 bit with 0xFFFF for no path or
+//					32 bit with INT_MAX for no path as isWide tells
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		const void *; (nodes + 1)^2 costs, NULL if empty
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+const void *DistanceTable::costArray() const
+{
+	return wide ? (const void *)fullData : (const void *)narrowData;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	const int *DistanceTable::pathArray(int row) const
+// Title:		Previous nodes of a row in use
+// Description: Returns the previous node row of row
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int row; array index of the source node
+// Returns:		const int *; nodes + 1 previous nodes, NULL if not kept
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+const int *DistanceTable::pathArray(int row) const
+{
+	return pathData[row];
+}
+
+//-----------------------------------------------------------------------------
+// Function:	size_t DistanceTable::cell(int row, int column) const
+// Title:		Index into cost storage
+// Description: Returns the position of [row][column] in the contiguous row
+//					major cost array
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int row; array index of the source node
+//				int column; array index of the destination node
+// Returns:		size_t; position of the element
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+size_t DistanceTable::cell(int row, int column) const
+{
+	return (size_t)row * (nodes + 1) + column;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	int DistanceTable::dist(int row, int column) const
+// Title:		Cost of a pair
+// Description: Returns the lowest cost stored from row to column
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int row; array index of the source node
+//				int column; array index of the destination node
+// Returns:		int; lowest cost, INT_MAX if no path is stored
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Reads the arrays in use
+//-----------------------------------------------------------------------------
+int DistanceTable::dist(int row, int column) const
+{
+	if (wide)
+	{
+		return fullData[cell(row, column)];
+	}
+	uint16_t value = narrowData[cell(row, column)];
+	return value == NARROW_NONE ? INT_MAX : value;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void DistanceTable::keepPaths(int row)
+// Title:		Keeps previous nodes of a row
+// Description: Gives row a previous node row if it has none. Its entries
+//					are filled by the next set or storeRow of that row. Only
+//					allocates the one row, so rows of different sources may
+//					be kept from different threads once the table is owned
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int row; array index of the source node
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Attached rows count as kept
+//-----------------------------------------------------------------------------
+void DistanceTable::keepPaths(int row)
+{
+	if (pathData[row] == NULL)
+	{
+		paths[row].assign(nodes + 1, 0);
+		pathData[row] = &paths[row][0];
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void DistanceTable::dropPaths(int row)
+// Title:		Releases previous nodes of a row
+// Description: Frees the previous node row of row, keeping its costs
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int row; array index of the source node
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Lets go of attached rows
+//-----------------------------------------------------------------------------
+void DistanceTable::dropPaths(int row)
+{
+	vector<int>().swap(paths[row]);
+	pathData[row] = NULL;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	bool DistanceTable::hasPaths(int row) const
+// Title:		Row keeps previous nodes
+// Description: Returns whether row has a previous node row
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int row; array index of the source node
+// Returns:		bool; true if paths from row can be read
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Counts attached rows
+//-----------------------------------------------------------------------------
+bool DistanceTable::hasPaths(int row) const
+{
+	return row >= 0 && row < (int)pathData.size() && pathData[row] != NULL;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	int DistanceTable::path(int row, int column) const
+// Title:		Previous node of a pair
+// Description: Returns the node before column on the lowest cost path from
+//					row. Only meaningful when the row keeps paths and the
+//					cost of the pair is not INT_MAX
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int row; array index of the source node
+//				int column; array index of the destination node
+// Returns:		int; previous node
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Reads the arrays in use
+//-----------------------------------------------------------------------------
+int DistanceTable::path(int row, int column) const
+{
+	return pathData[row][column];
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void DistanceTable::set(int row, int column, int dist,
+//					int node)
+// Title:		Sets one pair
+// Description: Stores the cost of a pair, and its previous node when the
+//					row keeps paths. dist must not exceed the maxDistance
+//					given to reset or fit
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int row; array index of the source node
+//				int column; array index of the destination node
+//				int dist; lowest cost, INT_MAX if none
+//				int node; previous node on the path
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Copies attached arrays first
+//-----------------------------------------------------------------------------
+void DistanceTable::set(int row, int column, int dist, int node)
+{
+	ownCosts();
+	if (wide)
+	{
+		full[cell(row, column)] = dist;
+	}
+	else
+	{
+		narrow[cell(row, column)] = (dist == INT_MAX) ? NARROW_NONE
+			: (uint16_t)dist;
+	}
+	if (pathData[row] != NULL)
+	{
+		ownPaths(row);
+		paths[row][column] = node;
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void DistanceTable::storeRow(int row, const int *dist,
+//					const int *path)
+// Title:		Sets a whole row
+// Description: Copies entries 1 to nodes of a single source search into
+//					row, and its previous nodes when the row keeps paths.
+//					Rows are independent, so different rows may be stored
+//					from different threads once the table is owned
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int row; array index of the source node
+//				const int *dist; cost of each node, INT_MAX if none
+//				const int *path; previous node of each node, or NULL
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Copies attached arrays first
+//-----------------------------------------------------------------------------
+void DistanceTable::storeRow(int row, const int *dist, const int *path)
+{
+	ownCosts();
+	size_t start = cell(row, 0);
+	if (wide)
+	{
+		for (int w = 1; w <= nodes; w++)
+		{
+			full[start + w] = dist[w];
+		}
+	}
+	else
+	{
+		for (int w = 1; w <= nodes; w++)
+		{
+			narrow[start + w] = (dist[w] == INT_MAX) ? NARROW_NONE
+				: (uint16_t)dist[w];
+		}
+	}
+	storePaths(row, dist, path);
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void DistanceTable::storePaths(int row, const int *dist,
+//					const int *path)
+// Title:		Sets the previous nodes of a row
+// Description: Copies entries 1 to nodes of the previous nodes of a single
+//					source search into row when the row keeps paths, leaving
+//					its costs as they are
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int row; array index of the source node
+//				const int *dist; cost of each node, INT_MAX if none
+//				const int *path; previous node of each node, or NULL
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void DistanceTable::storePaths(int row, const int *dist, const int *path)
+{
+	if (path == NULL || pathData[row] == NULL)
+	{
+		return;
+	}
+	ownPaths(row);
+	vector<int> &previous = paths[row];
+	for (int w = 1; w <= nodes; w++)
+	{
+		previous[w] = (dist[w] == INT_MAX) ? 0 : path[w];
+	}
+}
@@ -0,0 +1,91 @@
+#ifndef DISTANCETABLE_H
+#define DISTANCETABLE_H
+//----------------------------------------------------------------------------
+// File: distancetable.h
+//
+// Description: Function outlines for the DistanceTable class, the all pairs
+//				result of GraphM. Costs are kept in one row major array of
+//				16 bit integers when the longest possible path fits, and of
+//				32 bit integers otherwise. Previous nodes are kept in
+//				separate rows that exist only for the sources given one by
+//				keepPaths, so a table of costs alone takes 2 or 4 bytes per
+//				pair instead of the 12 of a visited flag, cost and previous
+//				node. The arrays are either owned by the table or attached
+//				from memory owned elsewhere, such as a mapped table file
+//
+// Programmer:	Anthony Waddell
+//
+// Environment: Hardware: PC, i7
+//              Software: OS: Windows 10
+//              Compiles under Microsoft Visual C++ 2015, g++
+//-----------------------------------------------------------------------------
+#include <limits.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+using namespace std;
+
+class DistanceTable
+{
+public:
+	// Constructor
+	DistanceTable();
+
+	// Size for nodes nodes and costs up to maxDistance, all infinite
+	void reset(int nodes, long long maxDistance);
+	void clear();
+	bool empty() const;
+	int nodeCount() const;
+
+	// Use arrays owned elsewhere in place, they must outlive the table
+	void attach(int nodes, bool wide, const void *costs);
+	void attachPaths(int row, const int *path);
+	void own();
+
+	// Widen the costs if maxDistance no longer fits
+	void fit(long long maxDistance);
+	bool isWide() const;
+
+	// Arrays in use, costs are (nodes + 1)^2 of 2 or 4 bytes in row order
+	const void *costArray() const;
+	const int *pathArray(int row) const;
+
+	// Cost of a pair, INT_MAX if none
+	int dist(int row, int column) const;
+
+	// Previous node rows, only for sources given to keepPaths
+	void keepPaths(int row);
+	void dropPaths(int row);
+	bool hasPaths(int row) const;
+	int path(int row, int column) const;
+
+	// Set one pair, the previous node only if the row keeps paths
+	void set(int row, int column, int dist, int node);
+
+	// Set a whole row from search output, path may be NULL
+	void storeRow(int row, const int *dist, const int *path);
+	void storePaths(int row, const int *dist, const int *path);
+
+private:
+
+	static const uint16_t NARROW_NONE = 0xFFFF;  // no path in 16 bits
+
+	size_t cell(int row, int column) const;
+	void point();
+	void ownCosts();
+	void ownPaths(int row);
+
+	int nodes;                            // number of nodes, index 0 unused
+	bool wide;                            // costs kept in 32 bits
+	vector<uint16_t> narrow;              // owned costs when not wide
+	vector<int> full;                     // owned costs when wide
+	vector<vector<int> > paths;           // owned previous nodes, empty if
+	                                      // not kept
+	bool owned;                           // costs are the vectors above
+	const uint16_t *narrowData;           // costs in use when not wide
+	const int *fullData;                  // costs in use when wide
+	vector<const int *> pathData;         // previous nodes in use, NULL if
+	                                      // not kept
+};
+#endif
@@ -0,0 +1,329 @@
+//-----------------------------------------------------------------------------
+// File:		graphfile.cpp
+// Programmer:	Anthony Waddell
+// Resources:	http://man7.org/linux/man-pages/man2/mmap.2.html
+//-----------------------------------------------------------------------------
+#include "graphfile.h"
+#include <fstream>
+#include <string.h>
+
+//-----------------------------------------------------------------------------
+// Function:	GraphFile::GraphFile()
+// Title:		Constructor
+// Description: Constructs a closed graph file
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		N/A
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+GraphFile::GraphFile()
+{
+	base = NULL;
+	header = NULL;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	GraphFile::~GraphFile()
+// Title:		Destructor
+// Description: Releases the mapping, if open
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		N/A
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+GraphFile::~GraphFile()
+{
+	close();
+}
+
+//-----------------------------------------------------------------------------
+// Function:	bool GraphFile::write(const string &fileName,
+//					const NameTable &names, const CSRGraph &graph)
+// Title:		Writes a graph file
+// Description: Lays out the header, node names and packed edge arrays of
+//					graph and writes them to fileName. The arrays may be
+//					read from a mapping of fileName itself, so the file is
+//					written under a temporary name and then moved over it
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	const string &fileName; file to create or replace
+//				const NameTable &names; name of each node
+//				const CSRGraph &graph; edges to write
+// Returns:		bool; true if the whole file was written
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Writes the name table as it is laid out
+//				10/17/26 AW Writes a temporary file and renames it
+//-----------------------------------------------------------------------------
+bool GraphFile::write(const string &fileName, const NameTable &names,
+	const CSRGraph &graph)
+{
+	uint32_t nodes = (uint32_t)graph.nodeCount();
+	uint64_t edges = (uint64_t)graph.edgeCount();
+	if ((uint32_t)names.nodeCount() < nodes)
+	{
+		return false;
+	}
+
+	// Name index and names share the table layout, node 0 has an empty name
+	const uint32_t *nameIndex = names.indexArray();
+	size_t nameIndexBytes = (nodes + 2) * sizeof(uint32_t);
+
+	GraphFileHeader header;
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, "DJKGRAPH", 8);
+	header.version = GRAPH_FILE_VERSION;
+	header.byteOrder = 0x01020304;
+	header.nodes = nodes;
+	header.edges = edges;
+	header.nameBytes = nameIndex[nodes + 1];
+	header.nameIndexStart = MappedFile::alignUp(sizeof(GraphFileHeader));
+	header.nameStart = MappedFile::alignUp(header.nameIndexStart
+		+ nameIndexBytes);
+	header.offsetStart = MappedFile::alignUp(header.nameStart
+		+ header.nameBytes);
+	header.targetStart = MappedFile::alignUp(header.offsetStart
+		+ (uint64_t)(nodes + 2) * sizeof(int));
+	header.weightStart = MappedFile::alignUp(header.targetStart
+		+ edges * sizeof(int));
+	header.fileBytes = header.weightStart + edges * sizeof(int);
+
+	string tempName = MappedFile::tempName(fileName);
+	ofstream out(tempName.c_str(), ios::binary | ios::trunc);
+	if (!out)
+	{
+		return false;
+	}
+	out.write((const char *)&header, sizeof(header));
+	MappedFile::writeSection(out, header.nameIndexStart, nameIndex,
+		nameIndexBytes);
+	MappedFile::writeSection(out, header.nameStart, names.textData(),
+		(size_t)header.nameBytes);
+	MappedFile::writeSection(out, header.offsetStart, graph.offsetArray(),
+		(nodes + 2) * sizeof(int));
+	MappedFile::writeSection(out, header.targetStart, graph.targetArray(),
+		(size_t)edges * sizeof(int));
+	MappedFile::writeSection(out, header.weightStart, graph.weightArray(),
+		(size_t)edges * sizeof(int));
+	return MappedFile::replaceFile(out, tempName, fileName);
+}
+
+//-----------------------------------------------------------------------------
+// Function:	bool GraphFile::open(const string &fileName)
+// Title:		Opens a graph file
+// Description: Maps fileName read only and checks its header, section
+//					layout and edges. Nothing is copied, the edges are only
+//					read through once
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	const string &fileName; file to open
+// Returns:		bool; true if the file is a valid graph file
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Mapping moved to MappedFile
+//				10/17/26 AW Edges checked too
+//-----------------------------------------------------------------------------
+bool GraphFile::open(const string &fileName)
+{
+	close();
+	if (!file.open(fileName))
+	{
+		return false;
+	}
+	base = file.data();
+	header = (const GraphFileHeader *)base;
+	if (file.size() < sizeof(GraphFileHeader) || !validate())
+	{
+		close();
+		return false;
+	}
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	bool GraphFile::validate() const
+// Title:		Checks the file layout
+// Description: Checks magic, version and byte order, that every section
+//					lies inside the file on an 8 byte boundary, and that the
+//					name index and edge offsets never decrease and end where
+//					their sections do. Every edge must enter a node of the
+//					graph with a weight of 0 or more, INT_MAX marking a
+//					removed edge, as searches index by target and the radix
+//					heap needs costs that never decrease
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		bool; true if the layout is valid
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Checks edge targets and weights
+//-----------------------------------------------------------------------------
+bool GraphFile::validate() const
+{
+	const GraphFileHeader &h = *header;
+	size_t length = file.size();
+	if (memcmp(h.magic, "DJKGRAPH", 8) != 0 || h.version != GRAPH_FILE_VERSION
+		|| h.byteOrder != 0x01020304 || h.fileBytes != length
+		|| h.nodes >= (uint32_t)INT_MAX - 2 || h.edges > (uint64_t)INT_MAX)
+	{
+		return false;
+	}
+
+	// Each section in order, aligned, and long enough for its contents
+	uint64_t starts[5] = { h.nameIndexStart, h.nameStart, h.offsetStart,
+		h.targetStart, h.weightStart };
+	uint64_t bytes[5] = { (uint64_t)(h.nodes + 2) * sizeof(uint32_t),
+		h.nameBytes, (uint64_t)(h.nodes + 2) * sizeof(int),
+		h.edges * sizeof(int), h.edges * sizeof(int) };
+	uint64_t end = sizeof(GraphFileHeader);
+	for (int i = 0; i < 5; i++)
+	{
+		if (starts[i] % 8 != 0 || starts[i] < end || bytes[i] > length
+			|| starts[i] > length - bytes[i])
+		{
+			return false;
+		}
+		end = starts[i] + bytes[i];
+	}
+
+	const uint32_t *nameIndex = (const uint32_t *)(base + h.nameIndexStart);
+	const int *offsets = (const int *)(base + h.offsetStart);
+	if (nameIndex[0] != 0 || offsets[0] != 0 || offsets[1] != 0
+		|| nameIndex[h.nodes + 1] != h.nameBytes
+		|| (uint64_t)offsets[h.nodes + 1] != h.edges)
+	{
+		return false;
+	}
+	for (uint32_t i = 1; i <= h.nodes + 1; i++)
+	{
+		if (nameIndex[i] < nameIndex[i - 1] || offsets[i] < offsets[i - 1])
+		{
+			return false;
+		}
+	}
+
+	// Edges enter nodes 1 to nodes and never cost less than 0
+	const int *targets = (const int *)(base + h.targetStart);
+	const int *weights = (const int *)(base + h.weightStart);
+	for (uint64_t e = 0; e < h.edges; e++)
+	{
+		if (targets[e] < 1 || (uint32_t)targets[e] > h.nodes || weights[e] < 0)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void GraphFile::close()
+// Title:		Closes the file
+// Description: Releases the mapping. Graphs attached to the file must not
+//					be used after this
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Mapping moved to MappedFile
+//-----------------------------------------------------------------------------
+void GraphFile::close()
+{
+	file.close();
+	base = NULL;
+	header = NULL;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	bool GraphFile::isOpen() const
+// Title:		Checks for an open file
+// Description: Returns whether a valid file is open
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		bool; true if open
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+bool GraphFile::isOpen() const
+{
+	return header != NULL;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	int GraphFile::nodeCount() const
+// Title:		Number of nodes
+// Description: Returns the number of nodes in the open file
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		int; number of nodes, 0 if not open
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+int GraphFile::nodeCount() const
+{
+	return header == NULL ? 0 : (int)header->nodes;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	const char *GraphFile::name(int node, size_t &length) const
+// Title:		Name of a node
+// Description: Returns the name of node in place in the file
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int node; subscript of the node, 1..nodeCount()
+//				size_t &length; set to the length of the name
+// Returns:		const char *; first character of the name, not terminated
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+const char *GraphFile::name(int node, size_t &length) const
+{
+	const uint32_t *nameIndex =
+		(const uint32_t *)(base + header->nameIndexStart);
+	length = nameIndex[node + 1] - nameIndex[node];
+	return base + header->nameStart + nameIndex[node];
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void GraphFile::attach(CSRGraph &graph) const
+// Title:		Attaches the edges
+// Description: Makes graph read the packed edge arrays in place in the file
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	CSRGraph &graph; graph to attach, valid while file is open
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void GraphFile::attach(CSRGraph &graph) const
+{
+	graph.attach((int)header->nodes, (int)header->edges,
+		(const int *)(base + header->offsetStart),
+		(const int *)(base + header->targetStart),
+		(const int *)(base + header->weightStart));
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void GraphFile::attach(NameTable &names) const
+// Title:		Attaches the names
+// Description: Makes names read the node names in place in the file
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	NameTable &names; table to attach, valid while file is open
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void GraphFile::attach(NameTable &names) const
+{
+	names.attach((int)header->nodes,
+		(const uint32_t *)(base + header->nameIndexStart),
+		base + header->nameStart);
+}
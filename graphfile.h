@@ -0,0 +1,88 @@
+#ifndef GRAPHFILE_H
+#define GRAPHFILE_H
+//----------------------------------------------------------------------------
+// File: graphfile.h
+//
+// Description: Function outlines for the GraphFile class, a binary graph
+//				file that is mapped into memory and read in place. A file is
+//				a GraphFileHeader followed by the sections it locates, each
+//				starting on an 8 byte boundary:
+//					name index	uint32[nodes + 2], name i is the bytes
+//								from nameIndex[i] to nameIndex[i + 1]
+//					names		char[nameBytes], not terminated
+//					offsets		int32[nodes + 2], CSRGraph offsets
+//					targets		int32[edges], CSRGraph targets
+//					weights		int32[edges], CSRGraph weights
+//				Integers are in the byte order of the machine that wrote
+//				the file, which the header records
+//
+// Programmer:	Anthony Waddell
+//
+// Environment: Hardware: PC, i7
+//              Software: OS: Windows 10
+//              Compiles under Microsoft Visual C++ 2015, g++
+//-----------------------------------------------------------------------------
+#include "csrgraph.h"
+#include "mappedfile.h"
+#include "nametable.h"
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+const uint32_t GRAPH_FILE_VERSION = 1;
+
+// Fixed size start of a graph file
+struct GraphFileHeader
+{
+	char magic[8];             // "DJKGRAPH"
+	uint32_t version;          // GRAPH_FILE_VERSION of the writer
+	uint32_t byteOrder;        // 0x01020304 as stored by the writer
+	uint32_t nodes;            // number of nodes, index 0 not being used
+	uint32_t reserved;         // 0
+	uint64_t edges;            // number of edges
+	uint64_t nameBytes;        // length of the names section
+	uint64_t nameIndexStart;   // file position of each section
+	uint64_t nameStart;
+	uint64_t offsetStart;
+	uint64_t targetStart;
+	uint64_t weightStart;
+	uint64_t fileBytes;        // total length of the file
+};
+
+class GraphFile
+{
+public:
+	// Constructor and destructor
+	GraphFile();
+	~GraphFile();
+
+	// Write a graph and the names of its nodes
+	static bool write(const string &fileName, const NameTable &names,
+		const CSRGraph &graph);
+
+	// Map a file and check its header, close releases the mapping
+	bool open(const string &fileName);
+	void close();
+	bool isOpen() const;
+
+	// Contents of the open file, used in place
+	int nodeCount() const;
+	const char *name(int node, size_t &length) const;
+	void attach(CSRGraph &graph) const;
+	void attach(NameTable &names) const;
+
+private:
+
+	// Not copyable, the mapping has one owner
+	GraphFile(const GraphFile &);
+	GraphFile& operator=(const GraphFile &);
+
+	bool validate() const;
+
+	MappedFile file;                      // file contents in memory
+	const char *base;                     // start of file, NULL if not open
+	const GraphFileHeader *header;        // header at base
+};
+#endif
\ No newline at end of file
@@ -1,211 +1,295 @@
-//-----------------------------------------------------------------------------
-// File:		graphl.cpp
-// Programmer:	Anthony Waddell
-// Resources:	N/A
-//-----------------------------------------------------------------------------
-#include "graphl.h"
-
-//-----------------------------------------------------------------------------
-// Function:	GraphL::GraphL()
-// Title:		Constructor
-// Description: Constructs a graph, setting all node data values to NULL, all
-//					edgeheads to NULL, and all nodes visited to false. Assumes
-//					maximum of 100 nodes
-//
-// Programmer:	Anthony Waddell
-//
-// Parameters:	N/A
-// Returns:		void
-// History Log: 02/11/18 AW Completed Function
-//-----------------------------------------------------------------------------
-GraphL::GraphL()
-{
-	// Set all pointers to NULL and visited to false, assumes 100 nodes max
-	for (int i = 1; i < MAX_NODES; i++)
-	{
-		spanning_Graph[i].data = NULL;
-		spanning_Graph[i].edgeHead = NULL;
-		spanning_Graph[i].visited = false;
-	}
-}
-
-//-----------------------------------------------------------------------------
-// Function:	GraphL::~GraphL()
-// Title:		Destructor
-// Description: Destructor for GraphL class. Deletes all EdgeNode's of every
-//					data node and then deletes the data nodes themselves
-//
-// Programmer:	Anthony Waddell
-//
-// Parameters:	N/A
-// Returns:		void
-// History Log: 02/11/18 AW Completed Function
-//-----------------------------------------------------------------------------
-GraphL::~GraphL()
-{
-	// For each node
-	for (int i = 1; i <= size; i++)
-	{
-		if (spanning_Graph[i].edgeHead != NULL)
-		{
-			// While there are nodes after edgehead, remove them
-			while (spanning_Graph[i].edgeHead->nextEdge != NULL)
-			{
-				EdgeNode *temp = spanning_Graph[i].edgeHead;
-				spanning_Graph[i].edgeHead = temp->nextEdge;
-				delete temp;
-				temp = NULL;
-			}
-			// Remove edgehead
-			delete spanning_Graph[i].edgeHead;
-			spanning_Graph[i].edgeHead = NULL;
-		}
-		// Remove node
-		delete spanning_Graph[i].data;
-		spanning_Graph[i].data = NULL;
-	}
-}
-
-//-----------------------------------------------------------------------------
-// Function:	void GraphL::buildGraph(ifstream & sin)
-// Title:		Builds a GraphL object
-// Description: Reads data in from file and uses it to build a graph of
-//					vertices and edges. Stops when file reads values 0 0 
-//
-// Programmer:	Anthony Waddell
-//
-// Parameters:	ifstream & sin; reference to the input stream/file
-// Returns:		void
-// History Log: 02/11/18 AW Completed Function
-//-----------------------------------------------------------------------------
-void GraphL::buildGraph(ifstream & sin)
-{
-	string nodeName;  
-	string s_size;
-	int source; 
-	int destination;
-	int exit_value = 0;
-
-	// Get number of nodes and move to next line
-	sin >> size;
-	getline(sin, s_size);
-
-	// Assign node names to each node
-	for (int i = 1; i <= size; ++i)
-	{
-		getline(sin, nodeName);
-		NodeData* tmp = new NodeData(nodeName);
-		spanning_Graph[i].data = tmp;
-	}
-
-	// While there is data to read in
-	while (sin >> source >> destination)
-	{
-		// If actual data, not terminating values
-		if (source != exit_value || destination != exit_value)
-		{
-			EdgeNode *temp = new EdgeNode;
-			temp->adjGraphNode = destination;
-			// If it's not the first adjacent node
-			if (spanning_Graph[source].edgeHead != NULL)
-			{
-				temp->nextEdge = spanning_Graph[source].edgeHead;
-				spanning_Graph[source].edgeHead = temp;
-			}
-			// If first adjacent node
-			else
-			{
-				temp->nextEdge = NULL;
-				spanning_Graph[source].edgeHead = temp;
-			}
-		}
-		// If terminating values
-		else
-		{
-			break;
-		}
-	}
-}
-
-//-----------------------------------------------------------------------------
-// Function:	void GraphL::displayGraph()
-// Title:		Displays graph 
-// Description: Displays graph data of each node and all edge nodes connected
-//
-// Programmer:	Anthony Waddell
-//
-// Parameters:	N/A
-// Returns:		void
-// History Log: 02/11/18 AW Completed Function
-//-----------------------------------------------------------------------------
-void GraphL::displayGraph()
-{
-	// Display formatting
-	cout << "Graph:" << endl;
-	for (int i = 1; i <= size; i++)
-	{
-		cout << "Node " << i << "\t\t" << *spanning_Graph[i].data << endl;
-		// If there are adjacent nodes
-		if (spanning_Graph[i].edgeHead != NULL)
-		{
-			EdgeNode *temp = spanning_Graph[i].edgeHead;
-			// If there are *multiple* adjacent nodes
-			while (temp != NULL)
-			{
-				cout << setw(6) << "edge" << setw(3) << i << setw(3) << temp->adjGraphNode << endl;
-				temp = temp->nextEdge;
-			}
-		}
-	}
-	cout << endl;
-}
-
-//-----------------------------------------------------------------------------
-// Function:	void GraphL::depthFirstSearch()
-// Title:		Initiates a depth first search of a GraphL object
-// Description: Calls helper function to perform depth first dearch on a GraphL
-//					object beginning from the first node
-//
-// Programmer:	Anthony Waddell
-//
-// Parameters:	N/A
-// Returns:		void
-// History Log: 02/11/18 AW Completed Function
-//-----------------------------------------------------------------------------
-void GraphL::depthFirstSearch()
-{
-	// Begin from the first node index
-	int start = 1;
-	cout << "Depth-first ordering: ";
-	depthFirstSearch_Helper(start);
-	cout << endl << endl;
-}
-
-//-----------------------------------------------------------------------------
-// Function:	void GraphL::depthFirstSearch_Helper(int node)
-// Title:		Helper function for depth first search
-// Description: Recursively performs a depth first search beginning from the
-//					first node. Displays results to cout
-//
-// Programmer:	Anthony Waddell
-//
-// Parameters:	int node; the node currently being traversed
-// Returns:		void
-// History Log: 02/11/18 AW Completed Function
-//-----------------------------------------------------------------------------
-void GraphL::depthFirstSearch_Helper(int node)
-{
-	// Mark this node as visited, display the visting order number
-	spanning_Graph[node].visited = true;
-	cout << setw(3) << node;
-	EdgeNode *temp = spanning_Graph[node].edgeHead;
-	while (temp != NULL)
-	{
-		// If there are adjacent nodes after edgehead, try to visit them
-		if (spanning_Graph[temp->adjGraphNode].visited != true)
-		{
-			depthFirstSearch_Helper(temp->adjGraphNode);
-		}
-		temp = temp->nextEdge;
-	}
+//-----------------------------------------------------------------------------
+// File:		graphl.cpp
+// Programmer:	Anthony Waddell
+// Resources:	N/A
+//-----------------------------------------------------------------------------
+#include "graphl.h"
+
+//-----------------------------------------------------------------------------
+// Function:	GraphL::GraphL()
+// Title:		Constructor
+// Description: Constructs an empty graph. Nodes are allocated by buildGraph
+//					once the number of nodes is known
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		void
+// History Log: 02/11/18 AW Completed Function
+//				10/17/26 AW Storage moved to buildGraph
+//-----------------------------------------------------------------------------
+GraphL::GraphL()
+{
+	size = 0;
+	visitEpoch = 0;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	GraphL::~GraphL()
+// Title:		Destructor
+// Description: Destructor for GraphL class. The packed arrays and names free
+//					themselves
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		void
+// History Log: 02/11/18 AW Completed Function
+//				10/17/26 AW Frees arena chunks instead of each node
+//				10/17/26 AW No edge lists left to free
+//-----------------------------------------------------------------------------
+GraphL::~GraphL()
+{
+	clear();
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void GraphL::clear()
+// Title:		Empties the graph
+// Description: Drops the names and the packed edges
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Edges kept only in the packed arrays
+//-----------------------------------------------------------------------------
+void GraphL::clear()
+{
+	names.clear();
+	edges.build(0, vector<EdgeRecord>());
+	size = 0;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void GraphL::buildGraph(ifstream & sin)
+// Title:		Builds a GraphL object
+// Description: Reads data in from file and uses it to build a graph of
+//					vertices and edges. Stops when file reads values 0 0 
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	ifstream & sin; reference to the input stream/file
+// Returns:		void
+// History Log: 02/11/18 AW Completed Function
+//				10/17/26 AW Sizes storage from node count
+//				10/17/26 AW Builds packed edge arrays
+//				10/17/26 AW Reads through GraphParser
+//				10/17/26 AW Visited marks kept apart from the nodes
+//				10/17/26 AW Edges allocated from the arena
+//				10/17/26 AW Names read straight into the name table
+//				10/17/26 AW Edges kept only in the packed arrays
+//-----------------------------------------------------------------------------
+void GraphL::buildGraph(ifstream & sin)
+{
+	vector<EdgeRecord> stream;
+	int nodes = 0;
+	clear();
+
+	// Read node count, node names and edges up to the terminating values
+	GraphParser parser(sin);
+	parser.readGraph(2, nodes, names, stream);
+	if (!parser.error().empty())
+	{
+		cerr << "Graph data " << parser.error() << endl;
+	}
+
+	// Mark no node visited
+	size = max(nodes, 0);
+	visitMark.assign(size + 1, 0);
+	visitEpoch = 0;
+
+	// Pack edges newest first, the order head insertion gave each edge list.
+	// Edges naming nodes that do not exist are dropped
+	reverse(stream.begin(), stream.end());
+	edges.build(size, stream);
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void GraphL::displayGraph()
+// Title:		Displays graph 
+// Description: Displays graph data of each node and all edge nodes connected,
+//					newest edge first
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		void
+// History Log: 02/11/18 AW Completed Function
+//				10/17/26 AW Ends lines with '\n', flushing once at the end
+//				10/17/26 AW Names read from the name table
+//				10/17/26 AW Edges read from the packed arrays
+//-----------------------------------------------------------------------------
+void GraphL::displayGraph()
+{
+	const int *offsets = edges.offsetArray();
+	const int *targets = edges.targetArray();
+
+	// Display formatting
+	cout << "Graph:\n";
+	for (int i = 1; i <= size; i++)
+	{
+		size_t length = 0;
+		const char *name = names.name(i, length);
+		cout << "Node " << i << "\t\t";
+		cout.write(name, (streamsize)length);
+		cout << '\n';
+		// Each adjacent node, in edge list order
+		for (int edge = offsets[i]; edge < offsets[i + 1]; edge++)
+		{
+			cout << setw(6) << "edge" << setw(3) << i << setw(3) << targets[edge] << '\n';
+		}
+	}
+	cout << endl;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void GraphL::depthFirstSearch()
+// Title:		Initiates a depth first search of a GraphL object
+// Description: Calls helper function to perform depth first dearch on a GraphL
+//					object beginning from the first node
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		void
+// History Log: 02/11/18 AW Completed Function
+//				10/17/26 AW Starts a new traversal, so it can be repeated
+//-----------------------------------------------------------------------------
+void GraphL::depthFirstSearch()
+{
+	// Begin from the first node index
+	int start = 1;
+	cout << "Depth-first ordering: ";
+	startTraversal();
+	depthFirstSearch_Helper(start);
+	cout << endl << endl;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void GraphL::depthFirstSearch_Helper(int node)
+// Title:		Helper function for depth first search
+// Description: Performs a depth first search beginning from node, skipping
+//					nodes already visited by the current traversal. Displays
+//					results to cout
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int node; the node to start from
+// Returns:		void
+// History Log: 02/11/18 AW Completed Function
+//				10/17/26 AW Walks packed edge arrays
+//				10/17/26 AW Iterative, through visitFrom
+//-----------------------------------------------------------------------------
+void GraphL::depthFirstSearch_Helper(int node)
+{
+	dfsOrder.clear();
+	visitFrom(node, dfsOrder);
+
+	// Display the visting order
+	for (size_t i = 0; i < dfsOrder.size(); i++)
+	{
+		cout << setw(3) << dfsOrder[i];
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Function:	bool GraphL::depthFirstOrder(int start, vector<int> &order)
+// Title:		Depth first ordering
+// Description: Starts a new traversal and lists the nodes reached from start
+//					in depth first order, following each edge list from its
+//					head. Does no output
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int start; the node to start from
+//				vector<int> &order; set to the nodes in the order visited
+// Returns:		bool; false if start is not a node
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+bool GraphL::depthFirstOrder(int start, vector<int> &order)
+{
+	order.clear();
+	if (start < 1 || start > size)
+	{
+		return false;
+	}
+	startTraversal();
+	visitFrom(start, order);
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void GraphL::startTraversal()
+// Title:		Starts a traversal
+// Description: Moves to the next epoch, which leaves every node unvisited
+//					without clearing the marks. The marks are only cleared
+//					when the epoch wraps around
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void GraphL::startTraversal()
+{
+	visitEpoch++;
+	if (visitEpoch == 0)
+	{
+		fill(visitMark.begin(), visitMark.end(), 0);
+		visitEpoch = 1;
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void GraphL::visitFrom(int node, vector<int> &order)
+// Title:		Depth first visit
+// Description: Visits node and every node reachable from it not yet visited
+//					in this traversal, in the order the recursive search
+//					did. Each stack entry holds a node and the next of its
+//					edges to follow, so depth is limited only by memory
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int node; the node to start from
+//				vector<int> &order; nodes visited are appended
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void GraphL::visitFrom(int node, vector<int> &order)
+{
+	if (node < 1 || node > size || visitMark[node] == visitEpoch)
+	{
+		return;
+	}
+	const int *offsets = edges.offsetArray();
+	const int *targets = edges.targetArray();
+
+	// Mark this node as visited and follow its edges
+	visitMark[node] = visitEpoch;
+	order.push_back(node);
+	dfsStack.clear();
+	dfsStack.push_back(make_pair(node, offsets[node]));
+	while (!dfsStack.empty())
+	{
+		int current = dfsStack.back().first;
+		int &next = dfsStack.back().second;
+		if (next == offsets[current + 1])
+		{
+			// All edges followed, go back to the previous node
+			dfsStack.pop_back();
+			continue;
+		}
+
+		// If the next adjacent node is not visited, visit it
+		int adjacent = targets[next++];
+		if (visitMark[adjacent] != visitEpoch)
+		{
+			visitMark[adjacent] = visitEpoch;
+			order.push_back(adjacent);
+			dfsStack.push_back(make_pair(adjacent, offsets[adjacent]));
+		}
+	}
 }
\ No newline at end of file
@@ -1,456 +1,2179 @@
-//-----------------------------------------------------------------------------
-// File:		graphm.cpp
-// Programmer:	Anthony Waddell
-// Resources:	For findShortestPath
-//					https://en.wikipedia.org/wiki/Johnson%27s_algorithm
-//					http://www.coderslexicon.com/dijkstras-algorithm-for-c/
-//-----------------------------------------------------------------------------
-#include "graphm.h"
-
-//-----------------------------------------------------------------------------
-// Function:	GraphM::GraphM()
-// Title:		Constructor
-// Description: Constructs an empty Graph object, fills cost adjacency matrix
-//					with max values, node adjacency matrix with max values, 
-//					and sets all nodes visited to false. Assumes maximum of 
-//					100 nodes
-//
-// Programmer:	Anthony Waddell
-//
-// Parameters:	N/A
-// Returns:		N/A
-// History Log: 02/11/18 AW Completed Function
-//-----------------------------------------------------------------------------
-GraphM::GraphM()
-{
-	// Assume max array of 100 values with index 0 not being used
-	for (int i = 1; i < MAXNODES; i++)
-	{
-		for (int j = 1; j < MAXNODES; j++)
-		{
-			// Instantiate all values with infinity and set all visited to false
-			C[i][j] = INT_MAX;
-			T[i][j].dist = INT_MAX;
-			T[i][j].path = INT_MAX;
-			T[i][j].visited = false;
-		}
-	}
-}
-
-//-----------------------------------------------------------------------------
-// Function:	void GraphM::buildGraph(ifstream & sin)
-// Title:		Build graph from file
-// Description: Reads data in from file and uses it to build a graph of
-//					vertices and edges with associated weights. Stops when
-//					file reads values 0 0 
-//
-// Programmer:	Anthony Waddell
-//
-// Parameters:	ifstream & sin; reference to input stream/file
-// Returns:		void
-// History Log: 02/11/18 AW Completed Function
-//-----------------------------------------------------------------------------
-void GraphM::buildGraph(ifstream & sin)
-{
-
-	unsigned int source = 0;
-	unsigned int destination = 0;
-	unsigned int weight = 0;
-	int exit_value = 0;
-	string nodeName;
-	string s_size;
-
-	// Get number of nodes in the graph and run to next line
-	sin >> size;
-	getline(sin, s_size);
-
-	// Read in and build array of vertex names
-	for (int i = 1; i <= size; i++)
-	{
-		getline(sin, nodeName);
-		NodeData *temp = new NodeData(nodeName);
-		data[i] = *temp;
-		delete temp;
-	}
-
-	// Fill adjacency matrix with associated costs
-	while (sin >> source >> destination >> weight)
-	{
-		// Only fill values if not terminating sequence
-		if (source != exit_value || destination != exit_value)
-		{
-			C[source][destination] = weight;
-		}
-		// If terminating sequence, leave
-		else
-		{
-			break;
-		}
-	}
-}
-
-//-----------------------------------------------------------------------------
-// Function:	bool GraphM::insertEdge(int source, int destination, int weight)
-// Title:		Inserts an edge
-// Description: Inserts an edge between two vertices with supplied weight
-//
-// Programmer:	Anthony Waddell
-//
-// Parameters:	int source; the source vertice
-//				int destination; the destination vertice
-//				int weight; the associated weight of the edge
-// Returns:		bool; true if edge inserted, false if not
-// History Log: 02/11/18 AW Completed Function
-//-----------------------------------------------------------------------------
-bool GraphM::insertEdge(int source, int destination, int weight)
-{
-	bool inserted = false;
-
-	// If either vertice is out of bounds, or trying to insert source to source
-	// with weight greater than 0 do not insert
-	if (source < 1 || destination < 1 || source > size || destination > size 
-		|| weight < 0 || (source = destination && weight != 0))
-	{
-		return inserted;
-	}
-	// Else, insert edge and weight
-	else
-	{
-		C[source][destination] = weight;
-		inserted = true;
-		return inserted;
-	}
-}
-
-//-----------------------------------------------------------------------------
-// Function:	bool GraphM::removeEdge(int source, int destination)
-// Title:		Removes an edge
-// Description: Removes an edge between two vertices
-//
-// Programmer:	Anthony Waddell
-//
-// Parameters:	int source; the source vertice
-//				int destination; the destination vertice
-// Returns:		bool; true if edge removed, false if not
-// History Log: 02/11/18 AW Completed Function
-//-----------------------------------------------------------------------------
-bool GraphM::removeEdge(int source, int destination)
-{
-	bool removed = false;
-
-	// If either vertice is out of bounds or removing source to source
-	if (source < 1 || destination < 1 || source > size || destination > size 
-		|| source == destination)
-	{
-		return removed;
-	}
-	// Else, remove edge by setting value to infinity in cost matrix
-	else
-	{
-		C[source][destination] = INT_MAX;
-		removed = true;
-		return removed;
-	}
-}
-
-//-----------------------------------------------------------------------------
-// Function:	void GraphM::findShortestPath()
-// Title:		Finds the shortest path
-// Description: Finds shortest  available path between all nodes to all other
-//					nodes
-//
-// Programmer:	Anthony Waddell
-//
-// Parameters:	N/A
-// Returns:		void
-// History Log: 02/12/18 AW Completed Function
-//-----------------------------------------------------------------------------
-void GraphM::findShortestPath()
-{
-	int v = 0;
-
-	// Populate array of structs with available paths and weights
-	fill_List();
-
-	// For all nodes to all other nodes
-	for (int source = 1; source <= size; source++)
-	{
-		// Mark distance from source to source as 0 and begin by visiting node
-		T[source][source].dist = 0;
-		T[source][source].visited = true;
-
-		// Begin looking for lowest weights among neighboring vertice
-		do 
-		{
-			// Find next lowest cost vertex, if none exists, break
-			if (!(v = find_V(source)))
-			{
-				break;
-			}
-			// If next lowest cost found, mark visited
-			else
-			{
-				T[source][v].visited = true;
-			}
-			// For all nodes adjacent to v
-			for (int w = 1; w <= size; ++w)
-			{
-				// If they haven't been visited yet and are an actual path
-				if (T[source][w].visited || C[v][w] == INT_MAX)
-				{
-					continue;
-				}
-				// If cost of getting to this node is less than cost of source
-				// to vertex + cost of vertex to this node
-				int swapped = T[source][w].dist;
-				T[source][w].dist = min(T[source][w].dist, T[source][v].dist + C[v][w]);
-				if (swapped != T[source][w].dist)
-				{
-					T[source][w].path = v;
-				}
-			}
-		}
-		// While there are neighbor vertex to look at
-		while (v);
-	}
-}
-
-//-----------------------------------------------------------------------------
-// Function:	void GraphM::fill_List()
-// Title:		Populates adjacency list
-// Description: Populates adjacency list with known values for path's between
-//					nodes and their associated weights
-//
-// Programmer:	Anthony Waddell
-//
-// Parameters:	N/A
-// Returns:		void
-// History Log: 02/11/18 AW Completed Function
-//-----------------------------------------------------------------------------
-void GraphM::fill_List()
-{
-	for (int source = 1; source <= size; source++)
-	{
-		// Populate the adjacency list with relevant neighbor nodes and their
-		// associated weights
-		for (int i = 1; i <= size; i++)
-		{
-
-			if (C[source][i] != INT_MAX)
-			{
-				T[source][i].dist = C[source][i];
-				T[source][i].path = source;
-			}
-		}
-	}
-}
-
-//-----------------------------------------------------------------------------
-// Function:	int GraphM::find_V(int source)
-// Title:		Finds adjacent vertex with lowest cost
-// Description: Looks at all adjacent nodes to array index node represented by
-//					source. Returns lowest cost adjacent vertex represented by 
-//					array index value. 
-//
-// Programmer:	Anthony Waddell
-//
-// Parameters:	int source; array index of the source node
-// Returns:		int next_vertice; the next vertice to visit
-// History Log: 02/13/18 AW Completed Function
-//-----------------------------------------------------------------------------
-int GraphM::find_V(int source)
-{
-	int next_vertice = 0;
-	int minimum = INT_MAX;
-	for (int i = 1; i <= size; i++)
-	{
-		// If it hasn't been visited and has least cost begining with infinity
-		if (!T[source][i].visited && (C[source][i] < minimum))
-		{
-			minimum = C[source][i];
-			next_vertice = i;
-		}
-	}
-	// Return the next lowest cost vertice
-	return next_vertice;
-}
-
-//-----------------------------------------------------------------------------
-// Function:	void GraphM::displayAll()
-// Title:		Displays shortest paths
-// Description: Displays shortest paths beween all nodes, if path exists
-//
-// Programmer:	Anthony Waddell
-//
-// Parameters:	N/A
-// Returns:		void
-// History Log: 02/12/18 AW Completed Function
-//-----------------------------------------------------------------------------
-void GraphM::displayAll()
-{
-	string s_path = "";
-	string false_path = "----";
-	
-	// Display formatting
-	cout << "Description" << setw(18) << "From node" << setw(10) << "To node"
-		<< setw(13) << "Djikstra's" << setw(9) << "Path" << endl;
-	for (int i = 1; i <= size; i++)
-	{
-		// Display the current source node
-		cout << data[i] << endl;
-		for (int j = 1; j <= size; j++)
-		{
-			// Do not display path from same *this node to *this node
-			if (i != j)
-			{
-				// If valid path, display the source and destination indices
-				cout << setw(25) << i << setw(10) << j;
-				if (T[i][j].dist != INT_MAX)
-				{
-					// If if valid path, display the asociated cost
-					cout << setw(10) << T[i][j].dist;
-					s_path = path(i, j);
-				}
-				else
-				{
-					// If no path exists
-					cout << setw(10) << false_path;
-				}
-				cout << endl;
-			}
-		}
-		cout << endl;
-	}
-}
-
-//-----------------------------------------------------------------------------
-// Function:	void GraphM::display(int source, int destination)
-// Title:		Display the lowest cost and path from one node to another
-// Description: Recursively finds the lowest cost path from one source node
-//					to destination node if path exists
-//
-// Programmer:	Anthony Waddell
-//
-// Parameters:	int source; array index of the source node
-//				int destination; the array index of the destination node
-// Returns:		void
-// History Log: 02/13/18 AW Completed Function
-//-----------------------------------------------------------------------------
-void GraphM::display(int source, int destination)
-{
-	string path_values = "";
-	string false_path = "----";
-	
-	// If source or destination is out of bounds or is from *this node to 
-	// *this node
-	if (source < 1 || destination < 1 || source > size || destination > size 
-		|| source == destination)
-	{
-		// Display invalid path
-		cout << setw(5) << source << setw(10) << destination << setw(10) << 
-			false_path << endl;
-	}
-	// If source and destination are both in bounds
-	else
-	{
-		// Display the valid nodes indices
-		cout << setw(5) << source << setw(10) << destination;
-		{
-			if (T[source][destination].dist != INT_MAX)
-			{
-				// If path exists, display weight and get the path
-				cout << setw(10) << T[source][destination].dist;
-				path_values = path(source, destination);
-				cout << endl;
-				get_Names(path_values);
-			}
-			else
-			{
-				// Otherwise display invalid path
-				cout << setw(10) << false_path << endl;
-			}
-		}
-	}
-	cout << endl;
-}
-
-//-----------------------------------------------------------------------------
-// Function:	void GraphM::path(int source, int destination)
-// Title:		Recursively finds path
-// Description: Recursively finds the lowest cost path from one source node
-//					to destination node if path exists
-//
-// Programmer:	Anthony Waddell
-//
-// Parameters:	int source; array index of the source node
-//				int destination; the array index of the destination node
-// Returns:		void
-// History Log: 02/13/18 AW Completed Function
-//-----------------------------------------------------------------------------
-string GraphM::path(int source, int destination)
-{
-	string temp = "";
-
-	// If this was valid path
-	if (T[source][destination].dist != INT_MAX)
-	{
-		// If somewhere along path, not at source
-		if (source != destination)
-		{
-			// Recurse back through path until at source
-			int m_path = destination;
-			destination = T[source][destination].path;
-			temp = path(source, destination);
-			// Display path and track path
-			cout <<  " " << m_path;
-			temp.append(to_string(m_path));
-		}
-		// Base case, when back at source
-		else
-		{
-			// Display source and track path
-			cout << "\t\t " << source;
-			temp.append(to_string(source));
-			return temp;
-		}
-	}
-	// If ivalid path
-	else
-	{
-		return temp;
-	}
-	return temp;
-}
-
-
-//-----------------------------------------------------------------------------
-// Function:	void GraphM::get_Names(int source, int destination)
-// Title:		Prints out names of nodes
-// Description: Given source and destination node values represented as array
-//					indices, displays the node data of each node visited
-//					in the shortest path between source and destination
-//
-// Programmer:	Anthony Waddell
-//
-// Parameters:	int source; array index of the source node
-//				int destination; array index of the destination node
-// Returns:		void
-// History Log: 02/13/18 AW Completed Function
-//-----------------------------------------------------------------------------
-void GraphM::get_Names(string path)
-{
-	char c;
-	char ascii_offset = '0';
-
-	// Get names of vertices from path
-	for (int i = 0; i < path.length(); i++)
-	{
-		c = path[i];
-		// Convert from char to int and display the corresponding node name
-		int index = c - ascii_offset;
-		if (isdigit(c))
-		{
-			cout << data[index] << endl;
-		}
-	}
-}
\ No newline at end of file
+//-----------------------------------------------------------------------------
+// File:		graphm.cpp
+// Programmer:	Anthony Waddell
+// Resources:	For findShortestPath
+//					https://en.wikipedia.org/wiki/Johnson%27s_algorithm
+//					http://www.coderslexicon.com/dijkstras-algorithm-for-c/
+//				For graphHash
+//					http://www.isthe.com/chongo/tech/comp/fnv/
+//-----------------------------------------------------------------------------
+#include "graphm.h"
+
+//-----------------------------------------------------------------------------
+// Function:	static uint64_t hashValue(uint64_t hash, int value)
+// Title:		Adds an integer to a hash
+// Description: Runs the four bytes of value, low byte first, through 64 bit
+//					FNV-1a so the hash is the same on any machine
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	uint64_t hash; hash so far
+//				int value; integer to add
+// Returns:		uint64_t; hash with value added
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+static uint64_t hashValue(uint64_t hash, int value)
+{
+	uint32_t bits = (uint32_t)value;
+	for (int i = 0; i < 4; i++)
+	{
+		hash ^= (bits >> (8 * i)) & 0xFF;
+		hash *= 1099511628211ull;
+	}
+	return hash;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	GraphM::GraphM()
+// Title:		Constructor
+// Description: Constructs an empty Graph object. Storage for the nodes and
+//					the table is allocated by buildGraph once the number of
+//					nodes is known
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		N/A
+// History Log: 02/11/18 AW Completed Function
+//				10/17/26 AW Storage moved to buildGraph
+//				10/17/26 AW Clears the stats
+//-----------------------------------------------------------------------------
+GraphM::GraphM()
+{
+	size = 0;
+	threadLimit = 0;
+	reverseBuilt = false;
+	denseBuilt = false;
+	lazyPaths = false;
+	allPairsMethod = SPARSE_DIJKSTRA;
+	clearStats(stats);
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void GraphM::allocate(int nodes)
+// Title:		Sizes graph storage
+// Description: Sizes storage for nodes nodes with index 0 not being used
+//					and drops the table of any previous graph. Names are
+//					filled by the caller
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int nodes; number of nodes in the graph
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Table sized on first use by ensureTable
+//				10/17/26 AW Names kept in the name table
+//				10/17/26 AW Clears the distance table
+//				10/17/26 AW Closes any table file
+//				10/17/26 AW Drops cached rows
+//				10/17/26 AW Drops landmarks
+//				10/17/26 AW Drops the hierarchy
+//				10/17/26 AW Drops path trees
+//-----------------------------------------------------------------------------
+void GraphM::allocate(int nodes)
+{
+	size = max(nodes, 0);
+	table.clear();
+	tableFile.close();
+	rowCache.invalidate();
+	landmarks.clear();
+	hierarchy.clear();
+	rowSolved.assign(size + 1, false);
+	trees.assign(size + 1, PathTree());
+	reverseBuilt = false;
+	denseBuilt = false;
+	denseEdges.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void GraphM::ensureTable()
+// Title:		Sizes the table
+// Description: Sizes the table on first use, filling it with infinity.
+//					Point to point queries never need it, so a graph that is
+//					only queried never pays for its (size + 1)^2 entries.
+//					Costs are 16 bit when every path cost fits
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Compact table sized from the path bound
+//-----------------------------------------------------------------------------
+void GraphM::ensureTable()
+{
+	if (!table.empty() || size == 0)
+	{
+		return;
+	}
+	table.reset(size, pathBound());
+}
+
+//-----------------------------------------------------------------------------
+// Function:	long long GraphM::pathBound() const
+// Title:		Highest possible path cost
+// Description: Returns the cost of size - 1 edges of the highest edge
+//					cost, which no lowest cost path can exceed since it
+//					never visits a node twice
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		long long; upper bound of every lowest cost
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+long long GraphM::pathBound() const
+{
+	const int *weights = edges.weightArray();
+	int highest = 0;
+	for (int e = 0; e < edges.edgeCount(); e++)
+	{
+		if (weights[e] != INT_MAX && weights[e] > highest)
+		{
+			highest = weights[e];
+		}
+	}
+	return (long long)highest * max(size - 1, 1);
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void GraphM::buildGraph(ifstream & sin)
+// Title:		Build graph from file
+// Description: Reads data in from file and uses it to build a graph of
+//					vertices and edges with associated weights. Stops when
+//					file reads values 0 0 
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	ifstream & sin; reference to input stream/file
+// Returns:		void
+// History Log: 02/11/18 AW Completed Function
+//				10/17/26 AW Sizes storage from node count
+//				10/17/26 AW Builds packed edge arrays
+//				10/17/26 AW Reads through GraphParser
+//				10/17/26 AW Names read straight into the name table
+//				10/17/26 AW Builds the name index
+//				10/17/26 AW Times parsing and building
+//-----------------------------------------------------------------------------
+void GraphM::buildGraph(ifstream & sin)
+{
+	vector<EdgeRecord> stream;
+	int nodes = 0;
+
+	// Read node count, node names and edges up to the terminating sequence
+	{
+		PhaseTimer timer(stats, PHASE_PARSE);
+		GraphParser parser(sin);
+		parser.readGraph(3, nodes, names, stream);
+		if (!parser.error().empty())
+		{
+			cerr << "Graph data " << parser.error() << endl;
+		}
+	}
+
+	// Size storage, the names are already in the table
+	PhaseTimer timer(stats, PHASE_BUILD);
+	graphFile.close();
+	allocate(nodes);
+	names.buildIndex();
+	buildEdges(stream);
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void GraphM::buildEdges(vector<EdgeRecord> &stream)
+// Title:		Builds the packed edge arrays
+// Description: Sorts the edge stream by source and destination, keeps only
+//					the last cost given for each pair as the cost matrix did,
+//					and packs the result into the CSR graph
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	vector<EdgeRecord> &stream; edges in file order, reordered
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void GraphM::buildEdges(vector<EdgeRecord> &stream)
+{
+	stable_sort(stream.begin(), stream.end(), edgeBefore);
+
+	// Overwrite earlier duplicates with later ones
+	size_t kept = 0;
+	for (size_t i = 0; i < stream.size(); i++)
+	{
+		if (kept > 0 && stream[kept - 1].source == stream[i].source
+			&& stream[kept - 1].destination == stream[i].destination)
+		{
+			stream[kept - 1] = stream[i];
+		}
+		else
+		{
+			stream[kept++] = stream[i];
+		}
+	}
+	stream.resize(kept);
+	edges.build(size, stream);
+	reverseBuilt = false;
+	denseBuilt = false;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	bool GraphM::edgeBefore(const EdgeRecord &lhs,
+//					const EdgeRecord &rhs)
+// Title:		Edge ordering
+// Description: Orders edges by source, then destination
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	const EdgeRecord &lhs; left edge
+//				const EdgeRecord &rhs; right edge
+// Returns:		bool; true if lhs comes before rhs
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+bool GraphM::edgeBefore(const EdgeRecord &lhs, const EdgeRecord &rhs)
+{
+	if (lhs.source != rhs.source)
+	{
+		return lhs.source < rhs.source;
+	}
+	return lhs.destination < rhs.destination;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	bool GraphM::saveGraph(const string &fileName) const
+// Title:		Saves graph as a binary graph file
+// Description: Writes node names and packed edges to fileName in the binary
+//					graph file format, so a text file read by buildGraph can
+//					be converted once and mapped by loadGraph after that
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	const string &fileName; file to create or replace
+// Returns:		bool; true if the file was written
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+bool GraphM::saveGraph(const string &fileName) const
+{
+	return GraphFile::write(fileName, names, edges);
+}
+
+//-----------------------------------------------------------------------------
+// Function:	bool GraphM::loadGraph(const string &fileName)
+// Title:		Loads graph from a binary graph file
+// Description: Maps fileName and reads its packed edge arrays and node
+//					names in place, so nothing is parsed or copied. The
+//					mapping is kept until the next load or buildGraph,
+//					and the first edge change copies the arrays out of it
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	const string &fileName; file written by saveGraph
+// Returns:		bool; true if the graph was loaded
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Names read in place
+//				10/17/26 AW Builds the name index
+//-----------------------------------------------------------------------------
+bool GraphM::loadGraph(const string &fileName)
+{
+	edges = CSRGraph();
+	if (!graphFile.open(fileName))
+	{
+		names.clear();
+		allocate(0);
+		return false;
+	}
+	allocate(graphFile.nodeCount());
+	graphFile.attach(names);
+	graphFile.attach(edges);
+	names.buildIndex();
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	bool GraphM::saveTable(const string &fileName) const
+// Title:		Saves the table
+// Description: Writes the lowest costs, kept previous node rows and solved
+//					rows to fileName with the hash of the graph, so a later
+//					run on the same graph can load them instead of solving
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	const string &fileName; file to create or replace
+// Returns:		bool; true if the file was written, false if the table was
+//					never sized or the file could not be written
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+bool GraphM::saveTable(const string &fileName) const
+{
+	return TableFile::write(fileName, graphHash(), table, rowSolved);
+}
+
+//-----------------------------------------------------------------------------
+// Function:	bool GraphM::loadTable(const string &fileName)
+// Title:		Loads a saved table
+// Description: Maps a table written by saveTable and reads it in place, so
+//					display and displayAll can start at once. The file is
+//					only used when it was saved for a graph with the same
+//					edges as this one. Otherwise the current table is kept.
+//					The mapping is kept until the next load of a graph or
+//					table, and the first change to the table copies what it
+//					writes out of it
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	const string &fileName; file written by saveTable
+// Returns:		bool; true if the table was loaded
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Drops path trees
+//-----------------------------------------------------------------------------
+bool GraphM::loadTable(const string &fileName)
+{
+	// Check the file before letting go of the current table
+	TableFile candidate;
+	if (!candidate.open(fileName) || candidate.nodeCount() != size
+		|| candidate.graphHash() != graphHash())
+	{
+		return false;
+	}
+	candidate.close();
+
+	table.clear();
+	trees.assign(size + 1, PathTree());
+	if (!tableFile.open(fileName))
+	{
+		rowSolved.assign(size + 1, false);
+		return false;
+	}
+	tableFile.attach(table);
+	tableFile.solvedRows(rowSolved);
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	uint64_t GraphM::graphHash() const
+// Title:		Hash of the edges
+// Description: FNV-1a hash of the node count and of every edge's source,
+//					destination and cost. Edge hashes are added together, so
+//					the order edges are stored in, which depends on how the
+//					graph was built and changed, plays no part. Removed
+//					edges are left out and names play no part, since
+//					neither changes a cost
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		uint64_t; hash of the graph
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Independent of edge order
+//-----------------------------------------------------------------------------
+uint64_t GraphM::graphHash() const
+{
+	const uint64_t basis = 14695981039346656037ull;
+	const int *offsets = edges.offsetArray();
+	const int *targets = edges.targetArray();
+	const int *weights = edges.weightArray();
+	uint64_t sum = 0;
+	for (int v = 1; v <= size; v++)
+	{
+		for (int e = offsets[v]; e < offsets[v + 1]; e++)
+		{
+			if (weights[e] != INT_MAX)
+			{
+				uint64_t edge = hashValue(basis, v);
+				edge = hashValue(edge, targets[e]);
+				sum += hashValue(edge, weights[e]);
+			}
+		}
+	}
+	uint64_t hash = hashValue(basis, size);
+	hash = hashValue(hash, (int)(uint32_t)sum);
+	return hashValue(hash, (int)(uint32_t)(sum >> 32));
+}
+
+//-----------------------------------------------------------------------------
+// Function:	bool GraphM::insertEdge(int source, int destination, int weight)
+// Title:		Inserts an edge
+// Description: Inserts an edge between two vertices with supplied weight
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int source; the source vertice
+//				int destination; the destination vertice
+//				int weight; the associated weight of the edge
+// Returns:		bool; true if edge inserted, false if not
+// History Log: 02/11/18 AW Completed Function
+//				10/17/26 AW Updates packed edge arrays
+//				10/17/26 AW Repairs solved rows of T, fixed source to source
+//					test assigning instead of comparing
+//-----------------------------------------------------------------------------
+bool GraphM::insertEdge(int source, int destination, int weight)
+{
+	bool inserted = false;
+
+	// If either vertice is out of bounds, or trying to insert source to source
+	// with weight greater than 0 do not insert
+	if (source < 1 || destination < 1 || source > size || destination > size 
+		|| weight < 0 || weight == INT_MAX
+		|| (source == destination && weight != 0))
+	{
+		return inserted;
+	}
+	// Else, insert edge and weight
+	else
+	{
+		changeEdge(source, destination, weight);
+		inserted = true;
+		return inserted;
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Function:	bool GraphM::removeEdge(int source, int destination)
+// Title:		Removes an edge
+// Description: Removes an edge between two vertices
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int source; the source vertice
+//				int destination; the destination vertice
+// Returns:		bool; true if edge removed, false if not
+// History Log: 02/11/18 AW Completed Function
+//				10/17/26 AW Updates packed edge arrays
+//				10/17/26 AW Repairs solved rows of T
+//-----------------------------------------------------------------------------
+bool GraphM::removeEdge(int source, int destination)
+{
+	bool removed = false;
+
+	// If either vertice is out of bounds or removing source to source
+	if (source < 1 || destination < 1 || source > size || destination > size 
+		|| source == destination)
+	{
+		return removed;
+	}
+	// Else, remove edge by setting its cost to infinity
+	else
+	{
+		changeEdge(source, destination, INT_MAX);
+		removed = true;
+		return removed;
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void GraphM::changeEdge(int source, int destination,
+//					int weight)
+// Title:		Changes an edge and repairs the table
+// Description: Sets the cost of an edge in the packed edges, and in the
+//					reversed edges when they have been built, then repairs
+//					every table row already solved. A lower cost only spreads
+//					to the nodes it improves, a higher cost or removal only
+//					recomputes the nodes whose lowest cost path used the edge
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int source; the source vertice
+//				int destination; the destination vertice
+//				int weight; new cost of the edge, INT_MAX to remove it
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Widens table costs the new edge could overflow
+//				10/17/26 AW Drops cached rows
+//				10/17/26 AW Drops landmarks when an edge gets cheaper
+//				10/17/26 AW Drops the hierarchy
+//-----------------------------------------------------------------------------
+void GraphM::changeEdge(int source, int destination, int weight)
+{
+	int old = INT_MAX;
+	int edge = edges.findEdge(source, destination);
+	if (edge >= 0)
+	{
+		old = edges.weightArray()[edge];
+		edges.setWeight(edge, weight);
+	}
+	else if (weight != INT_MAX)
+	{
+		edges.addEdge(source, destination, weight);
+	}
+
+	// Keep reversed edges in step so they never need a full rebuild
+	if (reverseBuilt)
+	{
+		int back = reverseEdges.findEdge(destination, source);
+		if (back >= 0)
+		{
+			reverseEdges.setWeight(back, weight);
+		}
+		else if (weight != INT_MAX)
+		{
+			reverseEdges.addEdge(destination, source, weight);
+		}
+	}
+	if (denseBuilt)
+	{
+		denseEdges.setWeight(source, destination, weight);
+	}
+	if (old == weight || source == destination)
+	{
+		return;
+	}
+	rowCache.invalidate();
+	hierarchy.clear();
+	if (weight < old)
+	{
+		// Bounds from dearer edges stay below the new costs, not from cheaper
+		landmarks.clear();
+	}
+	if (weight != INT_MAX && !table.empty())
+	{
+		table.fit((long long)weight * max(size - 1, 1));
+	}
+
+	for (int row = 1; row <= size; row++)
+	{
+		if (!rowSolved[row])
+		{
+			continue;
+		}
+		if (weight < old)
+		{
+			repairDecrease(row, source, destination, weight);
+		}
+		else
+		{
+			repairIncrease(row, source, destination, old);
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void GraphM::repairDecrease(int row, int source,
+//					int destination, int weight)
+// Title:		Repairs a row after an edge got cheaper
+// Description: If the cheaper edge improves destination, improves it and
+//					runs Dijkstra from there, only queueing nodes whose cost
+//					goes down. Nodes it does not improve are never looked at
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int row; source node of the table row being repaired
+//				int source; node the changed edge leaves
+//				int destination; node the changed edge enters
+//				int weight; new cost of the edge
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Reads and writes the compact table
+//				10/17/26 AW Keeps the row's path tree in step
+//-----------------------------------------------------------------------------
+void GraphM::repairDecrease(int row, int source, int destination, int weight)
+{
+	int start = table.dist(row, source);
+	if (start == INT_MAX)
+	{
+		return;
+	}
+	long long cost = (long long)start + weight;
+	if (cost >= table.dist(row, destination))
+	{
+		return;
+	}
+	setEntry(row, destination, (int)cost, source);
+
+	repairHeap.clear();
+	repairHeap.push((int)cost, destination);
+	propagate(row);
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void GraphM::repairIncrease(int row, int source,
+//					int destination, int old)
+// Title:		Repairs a row after an edge got dearer or was removed
+// Description: If the edge is on the lowest cost path to destination, every
+//					node below destination in the path tree of row may now
+//					cost more. Those nodes are reset, given the best cost
+//					through an edge entering them from outside the subtree,
+//					and settled again with Dijkstra. Nodes outside the
+//					subtree keep their cost, it did not depend on the edge.
+//					A row without previous nodes has no path tree, so it is
+//					solved again if the old edge cost could have been on a
+//					lowest cost path to destination. Child lists of the tree
+//					are built on a row's first repair and kept in step by
+//					setEntry after that, so rows the edge is not on cost
+//					O(1) and the rest O(subtree and its edges)
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int row; source node of the table row being repaired
+//				int source; node the changed edge leaves
+//				int destination; node the changed edge enters
+//				int old; cost of the edge before the change
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Reads and writes the compact table, solves rows
+//					without previous nodes again
+//				10/17/26 AW Path tree kept between changes, not rebuilt
+//-----------------------------------------------------------------------------
+void GraphM::repairIncrease(int row, int source, int destination, int old)
+{
+	if (destination == row || table.dist(row, destination) == INT_MAX)
+	{
+		return;
+	}
+	if (!table.hasPaths(row))
+	{
+		int start = table.dist(row, source);
+		if (start != INT_MAX
+			&& (long long)start + old == table.dist(row, destination))
+		{
+			solveRow(row, scratch);
+		}
+		return;
+	}
+	if (table.path(row, destination) != source)
+	{
+		return;
+	}
+	if (!reverseBuilt)
+	{
+		reverseEdges.buildReverse(edges);
+		reverseBuilt = true;
+	}
+
+	// Collect and reset the subtree under destination
+	PathTree &tree = trees[row];
+	if (tree.head.empty())
+	{
+		buildTree(row);
+	}
+	if (affected.size() != (size_t)size + 1)
+	{
+		affected.assign(size + 1, false);
+	}
+	subtree.clear();
+	subtree.push_back(destination);
+	affected[destination] = true;
+	for (size_t i = 0; i < subtree.size(); i++)
+	{
+		for (int c = tree.head[subtree[i]]; c != 0; c = tree.next[c])
+		{
+			affected[c] = true;
+			subtree.push_back(c);
+		}
+	}
+	for (size_t i = 0; i < subtree.size(); i++)
+	{
+		setEntry(row, subtree[i], INT_MAX, 0);
+	}
+
+	// Best cost of each reset node through an edge from outside the subtree
+	const int *offsets = reverseEdges.offsetArray();
+	const int *targets = reverseEdges.targetArray();
+	const int *weights = reverseEdges.weightArray();
+	repairHeap.clear();
+	for (size_t i = 0; i < subtree.size(); i++)
+	{
+		int w = subtree[i];
+		int best = INT_MAX;
+		for (int e = offsets[w]; e < offsets[w + 1]; e++)
+		{
+			int from = targets[e];
+			int start = table.dist(row, from);
+			if (affected[from] || weights[e] == INT_MAX || start == INT_MAX)
+			{
+				continue;
+			}
+			long long cost = (long long)start + weights[e];
+			if (cost < best)
+			{
+				best = (int)cost;
+				setEntry(row, w, best, from);
+			}
+		}
+		if (best != INT_MAX)
+		{
+			repairHeap.push(best, w);
+		}
+	}
+	for (size_t i = 0; i < subtree.size(); i++)
+	{
+		affected[subtree[i]] = false;
+	}
+	propagate(row);
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void GraphM::propagate(int row)
+// Title:		Settles queued nodes of a row
+// Description: Runs Dijkstra on a table row from the nodes in repairHeap,
+//					queueing a node again only when its cost goes down
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int row; source node of the table row being repaired
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Reads and writes the compact table
+//				10/17/26 AW Keeps the row's path tree in step
+//-----------------------------------------------------------------------------
+void GraphM::propagate(int row)
+{
+	const int *offsets = edges.offsetArray();
+	const int *targets = edges.targetArray();
+	const int *weights = edges.weightArray();
+
+	int d = 0;
+	int v = 0;
+	while (repairHeap.pop(d, v))
+	{
+		if (d > table.dist(row, v))
+		{
+			continue;
+		}
+		for (int e = offsets[v]; e < offsets[v + 1]; e++)
+		{
+			if (weights[e] == INT_MAX)
+			{
+				continue;
+			}
+			long long cost = (long long)d + weights[e];
+			if (cost < table.dist(row, targets[e]))
+			{
+				setEntry(row, targets[e], (int)cost, v);
+				repairHeap.push((int)cost, targets[e]);
+			}
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void GraphM::buildTree(int row)
+// Title:		Builds the path tree of a row
+// Description: Links each node reached from row under its previous node.
+//					Costs O(V), paid once until the row is solved anew
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int row; source node of a table row with previous nodes
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void GraphM::buildTree(int row)
+{
+	PathTree &tree = trees[row];
+	tree.head.assign(size + 1, 0);
+	tree.next.assign(size + 1, 0);
+	tree.before.assign(size + 1, 0);
+	for (int w = 1; w <= size; w++)
+	{
+		if (w != row && table.dist(row, w) != INT_MAX)
+		{
+			int parent = table.path(row, w);
+			if (tree.head[parent] != 0)
+			{
+				tree.before[tree.head[parent]] = w;
+			}
+			tree.next[w] = tree.head[parent];
+			tree.head[parent] = w;
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void GraphM::setEntry(int row, int node, int cost,
+//					int previous)
+// Title:		Changes one entry of a row
+// Description: Sets the cost and previous node of node in row. When the row
+//					has a path tree, node is moved from under its old
+//					previous node to under the new one, or just taken out
+//					when it becomes unreachable
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int row; source node of the table row
+//				int node; node whose entry changes
+//				int cost; new lowest cost, INT_MAX for unreachable
+//				int previous; new previous node, 0 for none
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void GraphM::setEntry(int row, int node, int cost, int previous)
+{
+	PathTree &tree = trees[row];
+	if (!tree.head.empty() && node != row)
+	{
+		// Take node out of the children of its old previous node
+		if (table.dist(row, node) != INT_MAX)
+		{
+			int before = tree.before[node];
+			int after = tree.next[node];
+			if (before != 0)
+			{
+				tree.next[before] = after;
+			}
+			else
+			{
+				tree.head[table.path(row, node)] = after;
+			}
+			if (after != 0)
+			{
+				tree.before[after] = before;
+			}
+		}
+
+		// Make it the first child of the new one
+		if (cost != INT_MAX)
+		{
+			int first = tree.head[previous];
+			tree.before[node] = 0;
+			tree.next[node] = first;
+			if (first != 0)
+			{
+				tree.before[first] = node;
+			}
+			tree.head[previous] = node;
+		}
+	}
+	table.set(row, node, cost, previous);
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void GraphM::findShortestPath()
+// Title:		Finds the shortest path
+// Description: Finds shortest  available path between all nodes to all other
+//					nodes by running a single source search from every node.
+//					Sources are independent, each only writes its own row of
+//					the table, so they are shared out between threads which
+//					each take the next unsolved source as soon as they
+//					finish one. Delta stepping shares each source between
+//					the threads instead, so sources are solved in turn
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		void
+// History Log: 02/12/18 AW Completed Function
+//				10/17/26 AW Runs heap based search per source instead of
+//					scanning every column with find_V
+//				10/17/26 AW Solves sources on multiple threads
+//				10/17/26 AW Thread count from workerCount
+//				10/17/26 AW Builds the cost matrix of the dense method
+//				10/17/26 AW Solves all rows at once with Floyd-Warshall
+//					when chosen
+//				10/17/26 AW Copies a loaded table before solving
+//				10/17/26 AW Timed, adds the counters of its threads
+//				10/17/26 AW Sources in turn for delta stepping
+//-----------------------------------------------------------------------------
+void GraphM::findShortestPath()
+{
+	PhaseTimer timer(stats, PHASE_SOLVE);
+	ensureTable();
+
+	// Rows are stored from several threads, so copy a loaded table first
+	table.own();
+	AllPairsMethod method = chooseMethod();
+	ensureDense(method);
+	if (method == FLOYD_WARSHALL)
+	{
+		solveAllPairs();
+		return;
+	}
+	int threads = workerCount(size);
+
+	// Small graphs and a limit of one thread stay on the calling thread
+	if (threads <= 1 || method == DELTA_STEPPING)
+	{
+		for (int source = 1; source <= size; source++)
+		{
+			solveRow(source, scratch);
+		}
+		return;
+	}
+
+	// For all nodes to all other nodes
+	atomic<int> next(1);
+	vector<thread> workers;
+	vector<SearchCounters> work(threads);
+	for (int i = 0; i < threads; i++)
+	{
+		workers.push_back(thread(&GraphM::allPairsWorker, this, &next,
+			&work[i]));
+	}
+	for (int i = 0; i < threads; i++)
+	{
+		workers[i].join();
+		stats.counters.add(work[i]);
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void GraphM::allPairsWorker(atomic<int> *next,
+//					SearchCounters *work)
+// Title:		All pairs worker thread
+// Description: Claims sources from the shared counter until none are left
+//					and solves each with scratch storage owned by this thread
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	atomic<int> *next; next source not yet claimed
+//				SearchCounters *work; set to the work of this thread
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Hands back its counters
+//-----------------------------------------------------------------------------
+void GraphM::allPairsWorker(atomic<int> *next, SearchCounters *work)
+{
+	SearchScratch local;
+	int source = 0;
+	while ((source = next->fetch_add(1)) <= size)
+	{
+		solveRow(source, local);
+	}
+	*work = local.engine.counters();
+}
+
+//-----------------------------------------------------------------------------
+// Function:	int GraphM::workerCount(int jobs) const
+// Title:		Threads to use
+// Description: Returns the number of threads to share jobs between, the
+//					thread limit or one per core, but never more than jobs
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int jobs; number of independent pieces of work
+// Returns:		int; threads to use, 1 or less to stay on this thread
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+int GraphM::workerCount(int jobs) const
+{
+	int threads = threadLimit;
+	if (threads <= 0)
+	{
+		threads = max((int)thread::hardware_concurrency(), 1);
+	}
+	return min(threads, jobs);
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void GraphM::setThreads(int threads)
+// Title:		Caps all pairs threads
+// Description: Sets the most threads findShortestPath may use. 0 uses one
+//					thread per core, 1 keeps all work on the calling thread
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int threads; thread limit, 0 for one per core
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void GraphM::setThreads(int threads)
+{
+	threadLimit = max(threads, 0);
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void GraphM::setAllPairsMethod(AllPairsMethod method)
+// Title:		Chooses the all pairs search
+// Description: Sets how findShortestPath solves the table. SPARSE_DIJKSTRA
+//					suits graphs with few edges per node, DENSE_DIJKSTRA
+//					scans a cost matrix with vector instructions and suits
+//					graphs with edges between most pairs, FLOYD_WARSHALL
+//					solves every row at once from the matrix and suits dense
+//					graphs of up to a few thousand nodes. DELTA_STEPPING
+//					splits each single source search between threads and
+//					suits one search over a very large graph. AUTO_METHOD
+//					picks Floyd-Warshall or the sparse search from the
+//					number of edges. All give the same costs. shortestFrom
+//					solves a single row, so it runs the dense search for
+//					DENSE_DIJKSTRA, delta stepping for DELTA_STEPPING and
+//					the sparse search otherwise
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	AllPairsMethod method; search to use
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Matrix kept for every method but the sparse one
+//				10/17/26 AW Delta stepping
+//-----------------------------------------------------------------------------
+void GraphM::setAllPairsMethod(AllPairsMethod method)
+{
+	allPairsMethod = method;
+	if (method == SPARSE_DIJKSTRA || method == DELTA_STEPPING)
+	{
+		denseEdges.clear();
+		denseBuilt = false;
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void GraphM::setDelta(int delta)
+// Title:		Sets the delta stepping bucket width
+// Description: Sets the bucket width of DELTA_STEPPING. Narrow buckets do
+//					little extra work but give each round few nodes to share
+//					between threads, wide ones the reverse. 0, the default,
+//					chooses a width from the edges when a search starts
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int delta; bucket width, 0 for automatic
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void GraphM::setDelta(int delta)
+{
+	stepping.setDelta(delta);
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void GraphM::setLazyPaths(bool lazy)
+// Title:		Chooses which previous node rows are kept
+// Description: With lazy false, the default, every row solved keeps its
+//					previous nodes. With lazy true the table holds only
+//					costs, 2 or 4 bytes a pair, and previous nodes are kept
+//					for the sources given to requestPaths. Rows already
+//					keeping previous nodes are not released
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	bool lazy; keep previous nodes only on request
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void GraphM::setLazyPaths(bool lazy)
+{
+	lazyPaths = lazy;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	bool GraphM::requestPaths(int source)
+// Title:		Keeps the previous nodes of a source
+// Description: Makes the paths from source readable by getPath. When the
+//					row of source holds only costs, it is solved again with
+//					its previous nodes, which are kept and repaired by edge
+//					changes from then on
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int source; array index of the source node
+// Returns:		bool; true if previous nodes had to be found, false if
+//					they were already kept or the row is not solved
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Drops the row's path tree
+//-----------------------------------------------------------------------------
+bool GraphM::requestPaths(int source)
+{
+	if (source < 1 || source > size || !rowSolved[source]
+		|| table.hasPaths(source))
+	{
+		return false;
+	}
+	table.keepPaths(source);
+	searchRow(source, scratch);
+	table.storePaths(source, &scratch.dist[0], &scratch.path[0]);
+	trees[source].head.clear();
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	AllPairsMethod GraphM::chooseMethod() const
+// Title:		Resolves the all pairs method
+// Description: Returns the method findShortestPath will run. AUTO_METHOD
+//					becomes Floyd-Warshall, O(V^3) but vectorized and cache
+//					blocked, when the graph has at most FLOYD_NODE_LIMIT
+//					nodes and at least 1 / FLOYD_DENSITY of all possible
+//					edges, and the sparse search, O(V E log V), otherwise.
+//					Removed edges and spare slots are not counted
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		AllPairsMethod; method to run, never AUTO_METHOD
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Counts only edges in use
+//-----------------------------------------------------------------------------
+GraphM::AllPairsMethod GraphM::chooseMethod() const
+{
+	if (allPairsMethod != AUTO_METHOD)
+	{
+		return allPairsMethod;
+	}
+	if (size <= FLOYD_NODE_LIMIT
+		&& (long long)edges.liveEdgeCount() * FLOYD_DENSITY
+		>= (long long)size * size)
+	{
+		return FLOYD_WARSHALL;
+	}
+	return SPARSE_DIJKSTRA;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void GraphM::ensureDense(AllPairsMethod method)
+// Title:		Builds the cost matrix
+// Description: Builds the cost matrix from the edges when method needs it
+//					and the matrix is missing or out of date. Edge changes
+//					after that update it in place
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	AllPairsMethod method; method about to run
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Also built for Floyd-Warshall
+//-----------------------------------------------------------------------------
+void GraphM::ensureDense(AllPairsMethod method)
+{
+	if ((method == DENSE_DIJKSTRA || method == FLOYD_WARSHALL) && !denseBuilt)
+	{
+		denseEdges.build(edges);
+		denseBuilt = true;
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void GraphM::solveAllPairs()
+// Title:		Solves the table with Floyd-Warshall
+// Description: Runs blocked Floyd-Warshall over the cost matrix and copies
+//					every row into the table as solveRow would have written
+//					it. The matrix holds no cost above INT_MAX, so its rows
+//					are read as int
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Stores rows in the compact table
+//				10/17/26 AW Drops path trees
+//-----------------------------------------------------------------------------
+void GraphM::solveAllPairs()
+{
+	vector<uint32_t> dist;
+	vector<int32_t> path;
+	denseEdges.allPairs(dist, path, workerCount(size));
+	int stride = denseEdges.rowLength();
+	for (int source = 1; source <= size; source++)
+	{
+		size_t row = (size_t)source * stride;
+		if (!lazyPaths)
+		{
+			table.keepPaths(source);
+		}
+		table.storeRow(source, (const int *)&dist[row], &path[row]);
+		trees[source].head.clear();
+		rowSolved[source] = true;
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void GraphM::shortestFrom(int source)
+// Title:		Finds the shortest paths from one node
+// Description: Finds lowest cost path from source to every other node with
+//					the heap based Dijkstra engine and stores the costs and
+//					previous nodes in the table row of source. Costs
+//					O((V + E) log V)
+//					instead of the O(V^2) of scanning the cost matrix
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int source; array index of the source node
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Timed
+//-----------------------------------------------------------------------------
+void GraphM::shortestFrom(int source)
+{
+	if (source < 1 || source > size)
+	{
+		return;
+	}
+	PhaseTimer timer(stats, PHASE_SOLVE);
+	ensureTable();
+	ensureDense(allPairsMethod);
+	solveRow(source, scratch);
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void GraphM::shortestTree(int source, vector<int> &dist,
+//					vector<int> &path)
+// Title:		Shortest path tree of one node
+// Description: Runs the single source search of shortestFrom into the
+//					given vectors instead of the table, so the table is
+//					never allocated. Suits graphs too large for V^2 costs,
+//					for instance every node within reach of one depot
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int source; array index of the source node
+//				vector<int> &dist; set to the lowest cost of each node,
+//					INT_MAX where there is no path, empty for a bad source
+//				vector<int> &path; set to the previous node of each node,
+//					0 for source and unreachable nodes
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void GraphM::shortestTree(int source, vector<int> &dist, vector<int> &path)
+{
+	dist.clear();
+	path.clear();
+	if (source < 1 || source > size)
+	{
+		return;
+	}
+	PhaseTimer timer(stats, PHASE_SOLVE);
+	ensureDense(allPairsMethod);
+	searchRow(source, scratch);
+	dist.swap(scratch.dist);
+	path.swap(scratch.path);
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void GraphM::solveRow(int source, SearchScratch &search)
+// Title:		Solves one row of the table
+// Description: Searches from source using the given scratch storage and
+//					copies its output into the table row of source. The
+//					previous nodes are copied too unless paths are lazy and
+//					none were requested for source
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int source; array index of the source node
+//				SearchScratch &search; storage owned by the calling thread
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Runs the dense method when selected
+//				10/17/26 AW Stores the row in the compact table
+//				10/17/26 AW Search moved to searchRow
+//				10/17/26 AW Solved flags a byte each, set from several threads
+//				10/17/26 AW Drops the row's path tree
+//-----------------------------------------------------------------------------
+void GraphM::solveRow(int source, SearchScratch &search)
+{
+	searchRow(source, search);
+
+	// Copy engine output into the table row for this source
+	if (!lazyPaths)
+	{
+		table.keepPaths(source);
+	}
+	table.storeRow(source, &search.dist[0], &search.path[0]);
+	trees[source].head.clear();
+	rowSolved[source] = true;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void GraphM::searchRow(int source, SearchScratch &search)
+// Title:		Single source search
+// Description: Runs the engine, the cost matrix search of the dense
+//					method or delta stepping on every thread, from source
+//					into the dist and path vectors of the given scratch
+//					storage, leaving the table untouched. Delta stepping
+//					has one set of storage, so only the calling thread may
+//					run it
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int source; array index of the source node
+//				SearchScratch &search; storage owned by the calling thread
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Moved from solveRow
+//				10/17/26 AW Runs delta stepping when selected
+//-----------------------------------------------------------------------------
+void GraphM::searchRow(int source, SearchScratch &search)
+{
+	if (allPairsMethod == DENSE_DIJKSTRA && denseBuilt)
+	{
+		denseEdges.run(source, search.dense, search.dist, search.path);
+	}
+	else if (allPairsMethod == DELTA_STEPPING)
+	{
+		stepping.run(edges, source, workerCount(size), search.dist,
+			search.path);
+	}
+	else
+	{
+		search.engine.run(edges, source, search.dist, search.path);
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Function:	int GraphM::query(int source, int destination,
+//					vector<int> &nodes, bool bidirectional)
+// Title:		Point to point shortest path
+// Description: Finds the lowest cost path from source to destination with a
+//					search that stops once destination is settled. Does not
+//					need findShortestPath and leaves the table untouched. The
+//					bidirectional search also grows from destination over
+//					the reversed edges, which are built on first use. When
+//					landmarks are built, the one way search is A* steered by
+//					their bounds. A built hierarchy answers instead of either
+//					search, and the row cache, when on, before all of them
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int source; array index of the source node
+//				int destination; array index of the destination node
+//				vector<int> &nodes; set to the nodes of the path in order,
+//					empty if there is no path
+//				bool bidirectional; search from both ends
+// Returns:		int; lowest cost, INT_MAX if no path exists
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Answers from the row cache when it is on
+//				10/17/26 AW Timed
+//				10/17/26 AW A* search when landmarks are built
+//				10/17/26 AW Answers from the hierarchy when built
+//-----------------------------------------------------------------------------
+int GraphM::query(int source, int destination, vector<int> &nodes,
+	bool bidirectional)
+{
+	nodes.clear();
+	if (source < 1 || destination < 1 || source > size || destination > size)
+	{
+		return INT_MAX;
+	}
+	PhaseTimer timer(stats, PHASE_QUERY);
+	if (rowCache.enabled())
+	{
+		return cachedQuery(source, destination, nodes);
+	}
+	if (!hierarchy.empty())
+	{
+		return hierarchy.query(source, destination, nodes);
+	}
+	if (!bidirectional && !landmarks.empty())
+	{
+		return scratch.engine.queryLandmarks(edges, landmarks, source,
+			destination, nodes);
+	}
+	if (!bidirectional)
+	{
+		return scratch.engine.query(edges, source, destination, nodes);
+	}
+	if (!reverseBuilt)
+	{
+		reverseEdges.buildReverse(edges);
+		reverseBuilt = true;
+	}
+	return scratch.engine.queryBidirectional(edges, reverseEdges, source,
+		destination, nodes);
+}
+
+//-----------------------------------------------------------------------------
+// Function:	bool GraphM::buildLandmarks(int count)
+// Title:		Builds landmark bounds
+// Description: Picks count landmarks and finds the costs from and to each
+//					of them, 2 count searches and 8 count (size + 1) bytes.
+//					After that query runs A*, which on road like graphs
+//					settles a small fraction of the nodes plain Dijkstra
+//					does. 16 landmarks suit most graphs. An edge that gets
+//					cheaper drops the landmarks, dearer or removed edges
+//					keep them since their bounds are still valid
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int count; landmarks wanted, 0 to drop them
+// Returns:		bool; true if landmarks were built
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+bool GraphM::buildLandmarks(int count)
+{
+	landmarks.clear();
+	if (size < 1 || count < 1)
+	{
+		return false;
+	}
+	if (!reverseBuilt)
+	{
+		reverseEdges.buildReverse(edges);
+		reverseBuilt = true;
+	}
+	landmarks.build(edges, reverseEdges, count, scratch.engine);
+	return !landmarks.empty();
+}
+
+//-----------------------------------------------------------------------------
+// Function:	bool GraphM::saveLandmarks(const string &fileName) const
+// Title:		Saves the landmarks
+// Description: Writes the landmark costs to fileName with the hash of the
+//					graph, to be loaded alongside the graph by a later run
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	const string &fileName; file to create or replace
+// Returns:		bool; true if the file was written, false if there are no
+//					landmarks or the file could not be written
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+bool GraphM::saveLandmarks(const string &fileName) const
+{
+	return landmarks.save(fileName, graphHash());
+}
+
+//-----------------------------------------------------------------------------
+// Function:	bool GraphM::loadLandmarks(const string &fileName)
+// Title:		Loads saved landmarks
+// Description: Maps landmarks written by saveLandmarks and reads them in
+//					place. The file is only used when it was saved for a
+//					graph with the same edges as this one. Otherwise the
+//					current landmarks are kept
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	const string &fileName; file written by saveLandmarks
+// Returns:		bool; true if the landmarks were loaded
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+bool GraphM::loadLandmarks(const string &fileName)
+{
+	return landmarks.load(fileName, size, graphHash());
+}
+
+//-----------------------------------------------------------------------------
+// Function:	int GraphM::landmarkCount() const
+// Title:		Number of landmarks
+// Description: Returns the number of landmarks query uses
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		int; number of landmarks, 0 if query is plain Dijkstra
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+int GraphM::landmarkCount() const
+{
+	return landmarks.landmarkCount();
+}
+
+//-----------------------------------------------------------------------------
+// Function:	bool GraphM::buildHierarchy()
+// Title:		Builds a contraction hierarchy
+// Description: Contracts every node of the graph, after which query answers
+//					from the hierarchy in microseconds on road like graphs,
+//					with the path unpacked to the original nodes so
+//					printPath and printNames show it as before. Suits graphs
+//					that do not change, since any edge change drops the
+//					hierarchy. Building takes seconds per million edges on
+//					sparse graphs and much longer on dense ones
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		bool; true if a hierarchy was built
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+bool GraphM::buildHierarchy()
+{
+	hierarchy.build(edges);
+	return !hierarchy.empty();
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void GraphM::dropHierarchy()
+// Title:		Drops the contraction hierarchy
+// Description: Frees the hierarchy, so query searches the graph again
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void GraphM::dropHierarchy()
+{
+	hierarchy.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Function:	int GraphM::shortcutCount() const
+// Title:		Number of shortcuts
+// Description: Returns the shortcuts the hierarchy added to the graph
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		int; number of shortcuts, 0 if no hierarchy
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+int GraphM::shortcutCount() const
+{
+	return hierarchy.shortcutCount();
+}
+
+//-----------------------------------------------------------------------------
+// Function:	int GraphM::cachedQuery(int source, int destination,
+//					vector<int> &nodes)
+// Title:		Point to point shortest path through the row cache
+// Description: Reads the cost and path from the cached row of source. On a
+//					miss, searches from source to every node and caches the
+//					row, so each later query from source is a lookup. A row
+//					too large for the cache is used once and not kept
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int source; array index of the source node
+//				int destination; array index of the destination node
+//				vector<int> &nodes; set to the nodes of the path in order,
+//					empty if there is no path
+// Returns:		int; lowest cost, INT_MAX if no path exists
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+int GraphM::cachedQuery(int source, int destination, vector<int> &nodes)
+{
+	const CachedRow *row = rowCache.find(source);
+	if (row == NULL)
+	{
+		searchRow(source, scratch);
+		row = rowCache.insert(source, scratch.dist, scratch.path);
+	}
+	const vector<int> &dist = (row != NULL) ? row->dist : scratch.dist;
+	const vector<int> &path = (row != NULL) ? row->path : scratch.path;
+	if (dist[destination] == INT_MAX)
+	{
+		return INT_MAX;
+	}
+
+	// Walk back until at source, a path never has more than size nodes
+	int node = destination;
+	while (node != source && (int)nodes.size() < size)
+	{
+		nodes.push_back(node);
+		node = path[node];
+	}
+	nodes.push_back(source);
+	reverse(nodes.begin(), nodes.end());
+	return dist[destination];
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void GraphM::setRowCache(size_t bytes)
+// Title:		Sizes the row cache
+// Description: Sets the most bytes query may spend keeping the costs and
+//					previous nodes of recent sources, about 8 (size + 1) per
+//					source. Suits workloads where a few sources get most of
+//					the queries on graphs too large for the table. Rows are
+//					dropped whenever an edge changes. 0, the default, turns
+//					the cache off. Zeroes the counters
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	size_t bytes; byte budget, 0 for no cache
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void GraphM::setRowCache(size_t bytes)
+{
+	rowCache.setCapacity(bytes);
+}
+
+//-----------------------------------------------------------------------------
+// Function:	RowCacheStats GraphM::rowCacheStats() const
+// Title:		Row cache counters
+// Description: Returns the hits, misses, evictions and invalidations of the
+//					row cache since it was sized, and the rows it holds
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		RowCacheStats; counters of the row cache
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+RowCacheStats GraphM::rowCacheStats() const
+{
+	return rowCache.stats();
+}
+
+//-----------------------------------------------------------------------------
+// Function:	SearchStats GraphM::searchStats() const
+// Title:		Work counters and phase times
+// Description: Returns the time spent in and calls of each phase, parsing
+//					and building in buildGraph, solving rows, queries and
+//					output of paths, and the vertices settled, edges relaxed,
+//					costs lowered and heap operations of every heap based
+//					search on any thread since the stats were cleared. The
+//					dense search and Floyd-Warshall are timed but not
+//					counted. Time per query is the query seconds over its
+//					calls, or its last seconds for the latest query
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		SearchStats; snapshot, all zero with DIJKSTRA_NO_STATS
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Adds hierarchy queries
+//				10/17/26 AW Adds delta stepping
+//-----------------------------------------------------------------------------
+SearchStats GraphM::searchStats() const
+{
+	SearchStats result = stats;
+	result.counters.add(scratch.engine.counters());
+	result.counters.add(hierarchy.counters());
+	result.counters.add(stepping.counters());
+	return result;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void GraphM::clearSearchStats()
+// Title:		Zeroes the stats
+// Description: Sets every phase time and work counter back to zero
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Clears hierarchy counters
+//				10/17/26 AW Clears delta stepping counters
+//-----------------------------------------------------------------------------
+void GraphM::clearSearchStats()
+{
+	clearStats(stats);
+	scratch.engine.clearCounters();
+	hierarchy.clearCounters();
+	stepping.clearCounters();
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void GraphM::printSearchStats(ostream &out) const
+// Title:		Prints the stats
+// Description: Prints the snapshot of searchStats, one line per phase then
+//					one per counter
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	ostream &out; stream to print to
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void GraphM::printSearchStats(ostream &out) const
+{
+	printStats(out, searchStats());
+}
+
+//-----------------------------------------------------------------------------
+// Function:	int GraphM::query(const string &source,
+//					const string &destination, vector<int> &nodes,
+//					bool bidirectional)
+// Title:		Point to point shortest path by name
+// Description: Looks up both nodes in the name index and finds the lowest
+//					cost path between them as query by index does
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	const string &source; name of the source node
+//				const string &destination; name of the destination node
+//				vector<int> &nodes; set to the nodes of the path in order,
+//					empty if there is no path
+//				bool bidirectional; search from both ends
+// Returns:		int; lowest cost, INT_MAX if no path exists or a name is
+//					not in the graph
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+int GraphM::query(const string &source, const string &destination,
+	vector<int> &nodes, bool bidirectional)
+{
+	return query(findNode(source), findNode(destination), nodes,
+		bidirectional);
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void GraphM::queryBatch(const vector<PathQuery> &queries,
+//					vector<int> &dist)
+// Title:		Batch of point to point costs
+// Description: Finds the lowest cost of every query. Queries are grouped by
+//					source and each distinct source is searched once, only
+//					until all of its destinations are settled. Sources are
+//					shared out between threads as findShortestPath does.
+//					Does not need findShortestPath and leaves the table
+//					untouched
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	const vector<PathQuery> &queries; pairs to find
+//				vector<int> &dist; set to the cost of each query in the
+//					same order, INT_MAX if no path or a node is invalid
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void GraphM::queryBatch(const vector<PathQuery> &queries, vector<int> &dist)
+{
+	runBatch(queries, dist, NULL);
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void GraphM::queryBatch(const vector<PathQuery> &queries,
+//					vector<int> &dist, vector<vector<int> > &paths)
+// Title:		Batch of point to point paths
+// Description: Finds the lowest cost and path of every query as the cost
+//					only batch does
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	const vector<PathQuery> &queries; pairs to find
+//				vector<int> &dist; set to the cost of each query in the
+//					same order, INT_MAX if no path or a node is invalid
+//				vector<vector<int> > &paths; set to the nodes of each
+//					path in order, empty if there is no path
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void GraphM::queryBatch(const vector<PathQuery> &queries, vector<int> &dist,
+	vector<vector<int> > &paths)
+{
+	paths.resize(queries.size());
+	runBatch(queries, dist, &paths);
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void GraphM::runBatch(const vector<PathQuery> &queries,
+//					vector<int> &dist, vector<vector<int> > *paths)
+// Title:		Runs a batch of queries
+// Description: Counting sorts the valid queries by source, marks where each
+//					source's group starts and solves the groups on the
+//					calling thread or on worker threads
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	const vector<PathQuery> &queries; pairs to find
+//				vector<int> &dist; set to the cost of each query
+//				vector<vector<int> > *paths; set to the path of each
+//					query, NULL when only costs are wanted
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Timed, adds the counters of its threads
+//-----------------------------------------------------------------------------
+void GraphM::runBatch(const vector<PathQuery> &queries, vector<int> &dist,
+	vector<vector<int> > *paths)
+{
+	PhaseTimer timer(stats, PHASE_QUERY);
+	dist.assign(queries.size(), INT_MAX);
+	QueryBatch batch;
+	batch.queries = &queries;
+	batch.dist = &dist;
+	batch.paths = paths;
+
+	// Count the queries of each source, invalid queries keep INT_MAX
+	vector<int> start(size + 2, 0);
+	for (size_t i = 0; i < queries.size(); i++)
+	{
+		const PathQuery &q = queries[i];
+		if (paths != NULL)
+		{
+			(*paths)[i].clear();
+		}
+		if (q.source >= 1 && q.destination >= 1 && q.source <= size
+			&& q.destination <= size)
+		{
+			start[q.source + 1]++;
+		}
+	}
+	for (int v = 1; v <= size + 1; v++)
+	{
+		if (start[v] > 0)
+		{
+			batch.groupStart.push_back(start[v - 1]);
+		}
+		start[v] += start[v - 1];
+	}
+
+	// Place each valid query in its source's group
+	batch.order.resize(start[size + 1]);
+	for (size_t i = 0; i < queries.size(); i++)
+	{
+		const PathQuery &q = queries[i];
+		if (q.source >= 1 && q.destination >= 1 && q.source <= size
+			&& q.destination <= size)
+		{
+			batch.order[start[q.source]++] = (int)i;
+		}
+	}
+	batch.groupStart.push_back((int)batch.order.size());
+
+	int groups = (int)batch.groupStart.size() - 1;
+	int threads = workerCount(groups);
+	if (threads <= 1)
+	{
+		for (int group = 0; group < groups; group++)
+		{
+			solveGroup(batch, group, scratch);
+		}
+		return;
+	}
+	batch.next = 0;
+	vector<thread> workers;
+	vector<SearchCounters> work(threads);
+	for (int i = 0; i < threads; i++)
+	{
+		workers.push_back(thread(&GraphM::batchWorker, this, &batch,
+			&work[i]));
+	}
+	for (int i = 0; i < threads; i++)
+	{
+		workers[i].join();
+		stats.counters.add(work[i]);
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void GraphM::solveGroup(QueryBatch &batch, int group,
+//					SearchScratch &search)
+// Title:		Solves the queries of one source
+// Description: Searches from the group's source until all its destinations
+//					are settled, then fills the result of each of its queries
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	QueryBatch &batch; batch being solved
+//				int group; group number in batch
+//				SearchScratch &search; storage of the calling thread
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void GraphM::solveGroup(QueryBatch &batch, int group, SearchScratch &search)
+{
+	const vector<PathQuery> &queries = *batch.queries;
+	int first = batch.groupStart[group];
+	int last = batch.groupStart[group + 1];
+	int source = queries[batch.order[first]].source;
+
+	search.targets.clear();
+	for (int i = first; i < last; i++)
+	{
+		search.targets.push_back(queries[batch.order[i]].destination);
+	}
+	search.engine.queryTargets(edges, source, search.targets);
+	for (int i = first; i < last; i++)
+	{
+		int query = batch.order[i];
+		vector<int> *nodes = NULL;
+		if (batch.paths != NULL)
+		{
+			nodes = &(*batch.paths)[query];
+		}
+		(*batch.dist)[query] = search.engine.pathTo(
+			queries[query].destination, nodes);
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void GraphM::batchWorker(QueryBatch *batch,
+//					SearchCounters *work)
+// Title:		Batch worker thread
+// Description: Claims source groups from the batch until none are left and
+//					solves each with scratch storage owned by this thread
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	QueryBatch *batch; batch being solved
+//				SearchCounters *work; set to the work of this thread
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Hands back its counters
+//-----------------------------------------------------------------------------
+void GraphM::batchWorker(QueryBatch *batch, SearchCounters *work)
+{
+	SearchScratch local;
+	int groups = (int)batch->groupStart.size() - 1;
+	int group = 0;
+	while ((group = batch->next.fetch_add(1)) < groups)
+	{
+		solveGroup(*batch, group, local);
+	}
+	*work = local.engine.counters();
+}
+
+//-----------------------------------------------------------------------------
+// Function:	int GraphM::findNode(const string &name) const
+// Title:		Finds a node by name
+// Description: Looks name up in the name index, an O(1) average probe
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	const string &name; the node data to find
+// Returns:		int; array index of the node, 0 if no node has the name.
+//					When names repeat the lowest index is returned
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+int GraphM::findNode(const string &name) const
+{
+	return names.find(name);
+}
+
+//-----------------------------------------------------------------------------
+// Function:	int GraphM::findNodes(const vector<string> &nodeNames,
+//					vector<int> &nodes) const
+// Title:		Finds many nodes by name
+// Description: Resolves every name of nodeNames through the name index in
+//					one pass, in the same order
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	const vector<string> &nodeNames; the node data to find
+//				vector<int> &nodes; set to the array index for each name,
+//					0 where no node has the name
+// Returns:		int; number of names found
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+int GraphM::findNodes(const vector<string> &nodeNames, vector<int> &nodes) const
+{
+	int found = 0;
+	nodes.resize(nodeNames.size());
+	for (size_t i = 0; i < nodeNames.size(); i++)
+	{
+		nodes[i] = names.find(nodeNames[i]);
+		found += (nodes[i] != 0);
+	}
+	return found;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void GraphM::displayAll()
+// Title:		Displays shortest paths
+// Description: Displays shortest paths beween all nodes, if path exists
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		void
+// History Log: 02/12/18 AW Completed Function
+//				10/17/26 AW Prints path through getPath and printPath
+//				10/17/26 AW Writes through a buffered TextResultWriter
+//-----------------------------------------------------------------------------
+void GraphM::displayAll()
+{
+	TextResultWriter writer(cout);
+	displayAll(writer);
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void GraphM::displayAll(ResultSink &sink)
+// Title:		Sends shortest paths to a sink
+// Description: Hands the lowest cost and path between every pair of
+//					different nodes to sink, one source at a time, then
+//					finishes the sink. Does no output of its own. With lazy
+//					paths, previous nodes found for a source are released
+//					once its rows are sent, so only one is held at a time
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	ResultSink &sink; receives the results
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Reads the compact table
+//				10/17/26 AW Timed
+//-----------------------------------------------------------------------------
+void GraphM::displayAll(ResultSink &sink)
+{
+	PhaseTimer timer(stats, PHASE_OUTPUT);
+	ensureTable();
+	for (int i = 1; i <= size; i++)
+	{
+		bool found = requestPaths(i);
+		size_t length = 0;
+		const char *name = names.name(i, length);
+		sink.beginSource(i, name, length);
+		for (int j = 1; j <= size; j++)
+		{
+			// Do not display path from same *this node to *this node
+			if (i != j)
+			{
+				getPath(i, j, pathNodes);
+				sink.pathRow(i, j, table.dist(i, j), pathNodes);
+			}
+		}
+		sink.endSource(i);
+		if (found)
+		{
+			table.dropPaths(i);
+		}
+	}
+	sink.finish();
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void GraphM::display(int source, int destination)
+// Title:		Display the lowest cost and path from one node to another
+// Description: Displays the lowest cost path from one source node to
+//					destination node and the names along it if path exists
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int source; array index of the source node
+//				int destination; the array index of the destination node
+// Returns:		void
+// History Log: 02/13/18 AW Completed Function
+//				10/17/26 AW Prints path through getPath and printPath
+//				10/17/26 AW Reads the compact table, requests the paths of
+//					source
+//				10/17/26 AW Timed
+//-----------------------------------------------------------------------------
+void GraphM::display(int source, int destination)
+{
+	PhaseTimer timer(stats, PHASE_OUTPUT);
+	string false_path = "----";
+	ensureTable();
+	
+	// If source or destination is out of bounds or is from *this node to 
+	// *this node
+	if (source < 1 || destination < 1 || source > size || destination > size 
+		|| source == destination)
+	{
+		// Display invalid path
+		cout << setw(5) << source << setw(10) << destination << setw(10) << 
+			false_path << endl;
+	}
+	// If source and destination are both in bounds
+	else
+	{
+		// Display the valid nodes indices
+		cout << setw(5) << source << setw(10) << destination;
+		{
+			if (table.dist(source, destination) != INT_MAX)
+			{
+				// If path exists, display weight and get the path
+				cout << setw(10) << table.dist(source, destination);
+				requestPaths(source);
+				getPath(source, destination, pathNodes);
+				printPath(cout, pathNodes);
+				cout << endl;
+				printNames(cout, pathNodes);
+			}
+			else
+			{
+				// Otherwise display invalid path
+				cout << setw(10) << false_path << endl;
+			}
+		}
+	}
+	cout << endl;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void GraphM::display(const string &source,
+//					const string &destination)
+// Title:		Display the lowest cost and path between named nodes
+// Description: Looks up both nodes in the name index and displays as
+//					display by index does. A name not in the graph shows as
+//					index 0 with no path
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	const string &source; name of the source node
+//				const string &destination; name of the destination node
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void GraphM::display(const string &source, const string &destination)
+{
+	display(findNode(source), findNode(destination));
+}
+
+//-----------------------------------------------------------------------------
+// Function:	bool GraphM::getPath(int source, int destination,
+//					vector<int> &nodes) const
+// Title:		Finds path
+// Description: Walks back from destination through the previous node of
+//					each node in the table row of source until at source,
+//					then puts the nodes in source first order. Does no
+//					output and, once nodes has grown to the longest path,
+//					no allocation. With lazy paths the row must have been
+//					given to requestPaths
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int source; array index of the source node
+//				int destination; the array index of the destination node
+//				vector<int> &nodes; set to the path, empty if none
+// Returns:		bool; true if a path exists
+// History Log: 02/13/18 AW Completed Function
+//				10/17/26 AW Iterative, fills a vector instead of printing
+//					and building a string
+//				10/17/26 AW Reads the compact table
+//-----------------------------------------------------------------------------
+bool GraphM::getPath(int source, int destination, vector<int> &nodes) const
+{
+	nodes.clear();
+
+	// If ivalid path
+	if (source < 1 || destination < 1 || source > size || destination > size
+		|| table.empty() || !table.hasPaths(source)
+		|| table.dist(source, destination) == INT_MAX)
+	{
+		return false;
+	}
+
+	// Walk back through path until at source, a path never has more than
+	// size nodes
+	int node = destination;
+	while (node != source && (int)nodes.size() < size)
+	{
+		nodes.push_back(node);
+		node = table.path(source, node);
+	}
+	nodes.push_back(source);
+	reverse(nodes.begin(), nodes.end());
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void GraphM::printPath(ostream &out,
+//					const vector<int> &nodes) const
+// Title:		Prints a path
+// Description: Prints the array indices of the nodes of a path in the path
+//					column layout of displayAll and display
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	ostream &out; stream to print to
+//				const vector<int> &nodes; path from getPath
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void GraphM::printPath(ostream &out, const vector<int> &nodes) const
+{
+	if (nodes.empty())
+	{
+		return;
+	}
+	out << "\t\t";
+	for (size_t i = 0; i < nodes.size(); i++)
+	{
+		out << " " << nodes[i];
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void GraphM::printNames(ostream &out,
+//					const vector<int> &nodes) const
+// Title:		Prints out names of nodes
+// Description: Displays the node data of each node visited in a path, one
+//					per line
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	ostream &out; stream to print to
+//				const vector<int> &nodes; path from getPath
+// Returns:		void
+// History Log: 02/13/18 AW Completed Function
+//				10/17/26 AW Takes node indices, so indices of 10 and above
+//					print correctly
+//				10/17/26 AW Names read from the name table
+//-----------------------------------------------------------------------------
+void GraphM::printNames(ostream &out, const vector<int> &nodes) const
+{
+	for (size_t i = 0; i < nodes.size(); i++)
+	{
+		size_t length = 0;
+		const char *name = names.name(nodes[i], length);
+		out.write(name, (streamsize)length);
+		out << endl;
+	}
+}
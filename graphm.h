@@ -1,63 +1,235 @@
-#ifndef GRAPHM_H
-#define GRAPHM_H
-//----------------------------------------------------------------------------
-// File: graphm.h
-// 
-// Description: Function outlines for the GraphM class
-// 
-// Programmer:	Anthony Waddell
-// 
-// Environment: Hardware: PC, i7
-//              Software: OS: Windows 10 
-//              Compiles under Microsoft Visual C++ 2015, g++
-//-----------------------------------------------------------------------------
-#include "nodedata.h"
-#include <algorithm>
-#include <iomanip>
-#include <limits.h>
-#include <string>
-
-const int MAXNODES = 101;
-
-using namespace std;
-class GraphM 
-{
-	// Struct to keep the shortest distance and associated path info
-	struct TableType
-	{
-		bool visited;          // whether node has been visited
-		int dist;              // shortest distance from source known so far
-		int path;              // previous node in path of min dist
-	};
-
-public:
-	 
-	// Constructor
-	GraphM();
-
-	// Build graph from file
-	void buildGraph(ifstream &sin);
-
-	// Insert and remove edges of graph
-	bool insertEdge(int source, int destination, int weight);	
-	bool removeEdge(int source, int destination);
-
-	// Find shortest path and helper functions
-	void findShortestPath();
-	void fill_List();
-	int find_V(int source);
-
-	// Display functions and helper functions
-	void displayAll();											
-	void display(int source, int destination);
-	string path(int source, int destination);
-	void get_Names(string path);
-
-private:
-
-	NodeData data[MAXNODES];              // data for graph nodes 
-	int C[MAXNODES][MAXNODES];            // Cost array, the adjacency matrix
-	int size;                             // number of nodes in the graph
-	TableType T[MAXNODES][MAXNODES];      // stores visited, distance, path. 
-};
+#ifndef GRAPHM_H
+#define GRAPHM_H
+//----------------------------------------------------------------------------
+// File: graphm.h
+// 
+// Description: Function outlines for the GraphM class
+// 
+// Programmer:	Anthony Waddell
+// 
+// Environment: Hardware: PC, i7
+//              Software: OS: Windows 10 
+//              Compiles under Microsoft Visual C++ 2015, g++
+//-----------------------------------------------------------------------------
+#include "nametable.h"
+#include "contraction.h"
+#include "csrgraph.h"
+#include "densegraph.h"
+#include "deltastepping.h"
+#include "dijkstra.h"
+#include "distancetable.h"
+#include "graphfile.h"
+#include "graphparser.h"
+#include "landmarks.h"
+#include "resultsink.h"
+#include "rowcache.h"
+#include "searchstats.h"
+#include "tablefile.h"
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <iomanip>
+#include <limits.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+// One point to point query of a batch
+struct PathQuery
+{
+	int source;                // subscript of the source node
+	int destination;           // subscript of the destination node
+};
+
+class GraphM 
+{
+	// Working storage for one single source search, one per thread
+	struct SearchScratch
+	{
+		DijkstraEngine engine; // search with its reusable heaps
+		vector<int> dist;      // engine output for one source
+		vector<int> path;      // engine output for one source
+		vector<int> targets;   // destinations of one batch source
+		DenseWork dense;       // rows of a cost matrix search
+	};
+
+	// A batch of queries grouped by source, shared by its worker threads
+	struct QueryBatch
+	{
+		const vector<PathQuery> *queries;  // queries as given
+		vector<int> order;                 // query numbers sorted by source
+		vector<int> groupStart;            // start of each source in order
+		vector<int> *dist;                 // cost of each query
+		vector<vector<int> > *paths;       // path of each query, or NULL
+		atomic<int> next;                  // next group not yet claimed
+	};
+
+	// Children of each node in the path tree of one table row, empty
+	// until the row's first repairIncrease and again once it is solved anew
+	struct PathTree
+	{
+		vector<int> head;      // first child of each node
+		vector<int> next;      // next sibling of each node
+		vector<int> before;    // previous sibling, 0 for a first child
+	};
+
+public:
+
+	// Search findShortestPath runs from each source
+	enum AllPairsMethod
+	{
+		SPARSE_DIJKSTRA,       // heap search over the edge lists
+		DENSE_DIJKSTRA,        // vectorized array search over a cost matrix
+		FLOYD_WARSHALL,        // blocked Floyd-Warshall over a cost matrix
+		DELTA_STEPPING,        // bucket search, each source on all threads
+		AUTO_METHOD            // Floyd-Warshall if dense enough, else sparse
+	};
+	 
+	// Constructor
+	GraphM();
+
+	// Build graph from file
+	void buildGraph(ifstream &sin);
+
+	// Binary graph files, loaded in place
+	bool saveGraph(const string &fileName) const;
+	bool loadGraph(const string &fileName);
+
+	// Solved tables kept in files for later runs on the same graph
+	bool saveTable(const string &fileName) const;
+	bool loadTable(const string &fileName);
+	uint64_t graphHash() const;
+
+	// Insert and remove edges of graph
+	bool insertEdge(int source, int destination, int weight);	
+	bool removeEdge(int source, int destination);
+
+	// Find shortest path and helper functions
+	void findShortestPath();
+	void shortestFrom(int source);
+	void setThreads(int threads);
+	void setAllPairsMethod(AllPairsMethod method);
+	void setDelta(int delta);
+
+	// Lowest costs and previous nodes from one node, without the table
+	void shortestTree(int source, vector<int> &dist, vector<int> &path);
+
+	// Previous node rows, kept for every solved source or only on request
+	void setLazyPaths(bool lazy);
+	bool requestPaths(int source);
+
+	// Point to point lowest cost and path, without the table
+	int query(int source, int destination, vector<int> &nodes,
+		bool bidirectional = false);
+	int query(const string &source, const string &destination,
+		vector<int> &nodes, bool bidirectional = false);
+
+	// Landmark bounds that make query an A* search, kept in files
+	bool buildLandmarks(int count);
+	bool saveLandmarks(const string &fileName) const;
+	bool loadLandmarks(const string &fileName);
+	int landmarkCount() const;
+
+	// Contraction hierarchy that answers query on a static graph
+	bool buildHierarchy();
+	void dropHierarchy();
+	int shortcutCount() const;
+
+	// Cache of single source rows in front of query
+	void setRowCache(size_t bytes);
+	RowCacheStats rowCacheStats() const;
+
+	// Many point to point queries, one search per distinct source
+	void queryBatch(const vector<PathQuery> &queries, vector<int> &dist);
+	void queryBatch(const vector<PathQuery> &queries, vector<int> &dist,
+		vector<vector<int> > &paths);
+
+	// Work counters and phase times, compiled out by DIJKSTRA_NO_STATS
+	SearchStats searchStats() const;
+	void clearSearchStats();
+	void printSearchStats(ostream &out) const;
+
+	// Node lookup by name, hashed when the graph is built
+	int findNode(const string &name) const;
+	int findNodes(const vector<string> &nodeNames, vector<int> &nodes) const;
+
+	// Display functions and helper functions
+	void displayAll();											
+	void displayAll(ResultSink &sink);
+	void display(int source, int destination);
+	void display(const string &source, const string &destination);
+	bool getPath(int source, int destination, vector<int> &nodes) const;
+	void printPath(ostream &out, const vector<int> &nodes) const;
+	void printNames(ostream &out, const vector<int> &nodes) const;
+
+private:
+
+	// Storage sizing and indexing
+	void allocate(int nodes);
+	void ensureTable();
+	long long pathBound() const;
+	void buildEdges(vector<EdgeRecord> &stream);
+	static bool edgeBefore(const EdgeRecord &lhs, const EdgeRecord &rhs);
+
+	// Edge changes and repair of solved rows
+	void changeEdge(int source, int destination, int weight);
+	void repairDecrease(int row, int source, int destination, int weight);
+	void repairIncrease(int row, int source, int destination, int old);
+	void propagate(int row);
+	void buildTree(int row);
+	void setEntry(int row, int node, int cost, int previous);
+
+	// Single source search into a table row
+	AllPairsMethod chooseMethod() const;
+	void ensureDense(AllPairsMethod method);
+	void solveAllPairs();
+	void solveRow(int source, SearchScratch &search);
+	void searchRow(int source, SearchScratch &search);
+	int cachedQuery(int source, int destination, vector<int> &nodes);
+	void allPairsWorker(atomic<int> *next, SearchCounters *work);
+
+	// Batched queries
+	void runBatch(const vector<PathQuery> &queries, vector<int> &dist,
+		vector<vector<int> > *paths);
+	void solveGroup(QueryBatch &batch, int group, SearchScratch &search);
+	void batchWorker(QueryBatch *batch, SearchCounters *work);
+	int workerCount(int jobs) const;
+
+	NameTable names;                      // names of graph nodes
+	GraphFile graphFile;                  // mapped file edges may be read from
+	CSRGraph edges;                       // Cost of each edge, packed by node
+	CSRGraph reverseEdges;                // edges reversed, built on demand
+	bool reverseBuilt;                    // false after edges have changed
+	DenseGraph denseEdges;                // cost matrix of the dense method
+	bool denseBuilt;                      // denseEdges matches edges
+	AllPairsMethod allPairsMethod;        // search used for table rows
+
+	static const int FLOYD_NODE_LIMIT = 4096;  // most nodes AUTO_METHOD
+	static const int FLOYD_DENSITY = 8;        // sends to Floyd-Warshall when
+	                                           // edges >= nodes^2 / this
+	int size;                             // number of nodes in the graph
+	DistanceTable table;                  // lowest costs and previous nodes
+	TableFile tableFile;                  // mapped file table may be read from
+	vector<uint8_t> rowSolved;            // rows of table holding results, a
+	                                      // byte each as threads set them
+	bool lazyPaths;                       // previous nodes only on request
+
+	SearchScratch scratch;                // search storage of calling thread
+	DeltaStepping stepping;               // search of DELTA_STEPPING
+	RowCache rowCache;                    // rows of recently queried sources
+	LandmarkIndex landmarks;              // A* bounds of query, if built
+	ContractionHierarchy hierarchy;       // upward search graphs, if built
+	vector<int> pathNodes;                // path buffer of the display functions
+	int threadLimit;                      // all pairs threads, 0 for one per core
+	SearchStats stats;                    // phase times, counters of finished
+	                                      // worker threads
+
+	BinaryHeap repairHeap;                // nodes queued by a repair
+	vector<PathTree> trees;               // path tree of each repaired row
+	vector<int> subtree;                  // nodes reset by repairIncrease
+	vector<bool> affected;                // membership of subtree, cleared
+	                                      // after each use
+};
 #endif
\ No newline at end of file
@@ -0,0 +1,379 @@
+//-----------------------------------------------------------------------------
+// File:		graphparser.cpp
+// Programmer:	Anthony Waddell
+// Resources:	N/A
+//-----------------------------------------------------------------------------
+#include "graphparser.h"
+#include <string.h>
+
+//-----------------------------------------------------------------------------
+// Function:	GraphParser::GraphParser(istream &in)
+// Title:		Constructor
+// Description: Constructs a parser reading from the current position of in.
+//					in can be moved back after a graph when tellg gives a
+//					position
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	istream &in; stream to parse
+// Returns:		N/A
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Keeps stream positions of blocks
+//-----------------------------------------------------------------------------
+GraphParser::GraphParser(istream &in) : in(in)
+{
+	blockStart = in.tellg();
+	seekable = blockStart != streampos(-1);
+	blockIndex = 0;
+	previousStart = blockStart;
+	previousIndex = 0;
+	pos = 0;
+	end = 0;
+	exhausted = !in.good();
+	lineNumber = 1;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	bool GraphParser::readGraph(int fields, int &nodes,
+//					NameTable &names, vector<EdgeRecord> &edges)
+// Title:		Reads one graph
+// Description: Reads a node count, the rest of its line, one name per line
+//					and edges until one whose source and destination are
+//					both 0, the same input buildGraph read with >> and
+//					getline. Afterwards the stream is left just past the
+//					terminating edge so the next graph can be read, or at
+//					end of file with eof set when the input ran out. A line
+//					that is not a number is reported by error() and ends the
+//					input
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int fields; integers per edge, 3 with a weight, 2 without
+//				int &nodes; set to the node count
+//				NameTable &names; set to the nodes names
+//				vector<EdgeRecord> &edges; set to the edges in file order,
+//					weight 1 when fields is 2
+// Returns:		bool; false if the input held no graph
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Names appended to one name table
+//-----------------------------------------------------------------------------
+bool GraphParser::readGraph(int fields, int &nodes, NameTable &names,
+	vector<EdgeRecord> &edges)
+{
+	nodes = 0;
+	names.clear();
+	edges.clear();
+	message.clear();
+
+	// Number of nodes and rest of its line
+	Scan scan = readNumber(nodes);
+	if (scan != SCAN_NUMBER)
+	{
+		if (scan == SCAN_BAD)
+		{
+			fail("a node count");
+		}
+		nodes = 0;
+		exhausted = true;
+		pos = end;
+		finish();
+		return false;
+	}
+	string line;
+	readLine(line);
+
+	names.reserve(nodes, 0);
+
+	// One name per line, line keeps its capacity so only the table grows
+	for (int i = 1; i <= nodes; i++)
+	{
+		readLine(line);
+		names.add(line.data(), line.size());
+	}
+
+	// Edges until the terminating zeros
+	int values[3] = { 0, 0, 1 };
+	while (true)
+	{
+		for (int f = 0; f < fields && scan == SCAN_NUMBER; f++)
+		{
+			scan = readNumber(values[f]);
+		}
+		if (scan != SCAN_NUMBER)
+		{
+			if (scan == SCAN_BAD)
+			{
+				fail(fields == 3 ? "source destination weight"
+					: "source destination");
+			}
+			exhausted = true;
+			pos = end;
+			break;
+		}
+		if (values[0] == 0 && values[1] == 0)
+		{
+			break;
+		}
+		EdgeRecord edge;
+		edge.source = values[0];
+		edge.destination = values[1];
+		edge.weight = values[2];
+		edges.push_back(edge);
+	}
+	finish();
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	const string &GraphParser::error() const
+// Title:		Last error
+// Description: Returns a description of the malformed input found by the
+//					last readGraph, with its line counted from where the
+//					parser started
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		const string &; the error, empty if the input was valid
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+const string &GraphParser::error() const
+{
+	return message;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	bool GraphParser::fill()
+// Title:		Reads the next block
+// Description: Moves the unscanned bytes to the front of the buffer and
+//					appends the next block of the stream after them,
+//					noting where in the stream the block starts
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		bool; true if any bytes were added
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Notes block positions instead of counting bytes
+//-----------------------------------------------------------------------------
+bool GraphParser::fill()
+{
+	if (exhausted)
+	{
+		return false;
+	}
+	if (pos > 0)
+	{
+		memmove(&buffer[0], &buffer[0] + pos, end - pos);
+		blockIndex -= (long long)pos;
+		previousIndex -= (long long)pos;
+		end -= pos;
+		pos = 0;
+	}
+	previousStart = blockStart;
+	previousIndex = blockIndex;
+	if (seekable)
+	{
+		blockStart = in.tellg();
+	}
+	blockIndex = (long long)end;
+	buffer.resize(end + CHUNK);
+	in.read(&buffer[end], CHUNK);
+	size_t count = (size_t)in.gcount();
+	end += count;
+	if (count < CHUNK)
+	{
+		exhausted = true;
+	}
+	return count > 0;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void GraphParser::need(size_t bytes)
+// Title:		Makes bytes available
+// Description: Reads more input if fewer than bytes are left to scan, so a
+//					token up to that length never crosses the buffer end
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	size_t bytes; bytes wanted from pos on
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void GraphParser::need(size_t bytes)
+{
+	if (end - pos < bytes)
+	{
+		fill();
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void GraphParser::skipSpace()
+// Title:		Skips white space
+// Description: Moves pos past white space, counting lines as it goes
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void GraphParser::skipSpace()
+{
+	while (true)
+	{
+		need(64);
+		const char *data = buffer.empty() ? NULL : &buffer[0];
+		while (pos < end && (data[pos] == ' '
+			|| (data[pos] >= '\t' && data[pos] <= '\r')))
+		{
+			lineNumber += (data[pos] == '\n');
+			pos++;
+		}
+		if (pos < end || exhausted)
+		{
+			return;
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Function:	Scan GraphParser::readNumber(int &value)
+// Title:		Scans an integer
+// Description: Skips white space and reads the digits that follow as a non
+//					negative integer no larger than INT_MAX
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int &value; set to the integer read
+// Returns:		Scan; SCAN_NUMBER if read, SCAN_END at end of input,
+//					SCAN_BAD if the next token is not such an integer
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+GraphParser::Scan GraphParser::readNumber(int &value)
+{
+	skipSpace();
+	need(32);
+	if (pos == end)
+	{
+		return SCAN_END;
+	}
+	const char *data = &buffer[0];
+	if (data[pos] < '0' || data[pos] > '9')
+	{
+		return SCAN_BAD;
+	}
+	long long number = 0;
+	size_t at = pos;
+	while (at < end && (unsigned)(data[at] - '0') <= 9)
+	{
+		number = number * 10 + (data[at] - '0');
+		if (number > INT_MAX)
+		{
+			return SCAN_BAD;
+		}
+		at++;
+	}
+	pos = at;
+	value = (int)number;
+	return SCAN_NUMBER;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	bool GraphParser::readLine(string &line)
+// Title:		Reads a line
+// Description: Reads up to and past the next newline like getline, keeping
+//					any carriage return before it
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	string &line; set to the line without its newline
+// Returns:		bool; false if there was no input left
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+bool GraphParser::readLine(string &line)
+{
+	line.clear();
+	if (pos == end && !fill())
+	{
+		return false;
+	}
+	while (true)
+	{
+		const char *data = &buffer[0];
+		const char *newline = (const char *)memchr(data + pos, '\n', end - pos);
+		if (newline != NULL)
+		{
+			line.append(data + pos, newline);
+			pos = newline - data + 1;
+			lineNumber++;
+			return true;
+		}
+		line.append(data + pos, data + end);
+		pos = end;
+		if (!fill())
+		{
+			return true;
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void GraphParser::fail(const string &expected)
+// Title:		Records an error
+// Description: Records that the line at pos did not hold what was expected
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	const string &expected; what the line should have held
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void GraphParser::fail(const string &expected)
+{
+	size_t stop = pos;
+	while (stop < end && buffer[stop] != '\n' && buffer[stop] != '\r')
+	{
+		stop++;
+	}
+	message = "line " + to_string(lineNumber) + ": expected " + expected
+		+ ", found \"" + string(&buffer[0] + pos, &buffer[0] + stop) + "\"";
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void GraphParser::finish()
+// Title:		Returns unread input to the stream
+// Description: Moves the stream back to the first byte not scanned, so the
+//					next reader starts after this graph. Seeks to the start
+//					of the block holding that byte and reads up to it, as
+//					bytes of a text mode stream need not match its
+//					positions. A block is at least 64 bytes longer than what
+//					fill keeps, so the byte is in the last block or the one
+//					before. When all input was used, leaves the stream at end
+//					of file with eof set as the failed >> of the old reader
+//					did
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Seeks to a tellg position and reads forward
+//-----------------------------------------------------------------------------
+void GraphParser::finish()
+{
+	if (exhausted && pos == end)
+	{
+		in.setstate(ios::eofbit | ios::failbit);
+		return;
+	}
+	if (seekable)
+	{
+		bool inBlock = (long long)pos >= blockIndex;
+		in.clear();
+		in.seekg(inBlock ? blockStart : previousStart);
+		in.ignore((streamsize)((long long)pos
+			- (inBlock ? blockIndex : previousIndex)));
+	}
+}
@@ -0,0 +1,80 @@
+#ifndef GRAPHPARSER_H
+#define GRAPHPARSER_H
+//----------------------------------------------------------------------------
+// File: graphparser.h
+//
+// Description: Function outlines for the GraphParser class, a bulk reader
+//				for the text graph format read by buildGraph: a node count,
+//				one name per line, then edges of 2 or 3 integers ending with
+//				a line of zeros. Input is read a large block at a time and
+//				integers are scanned straight out of the block. After a
+//				graph the stream is moved back to the first byte not
+//				scanned, using positions from tellg, which are the only
+//				ones a text mode stream can seek to when it turns CRLF into
+//				one character. A stream that cannot seek, such as a pipe,
+//				loses the input read ahead past the graph, so only its
+//				first graph can be read
+//
+// Programmer:	Anthony Waddell
+//
+// Environment: Hardware: PC, i7
+//              Software: OS: Windows 10
+//              Compiles under Microsoft Visual C++ 2015, g++
+//-----------------------------------------------------------------------------
+#include "csrgraph.h"
+#include "nametable.h"
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+class GraphParser
+{
+public:
+	// Constructor, reads from the current position of in
+	GraphParser(istream &in);
+
+	// Read the next graph, fields is 3 for weighted edges and 2 without
+	bool readGraph(int fields, int &nodes, NameTable &names,
+		vector<EdgeRecord> &edges);
+
+	// Problem found by the last readGraph, empty if none
+	const string &error() const;
+
+private:
+
+	// Result of scanning one number
+	enum Scan
+	{
+		SCAN_NUMBER,           // number read
+		SCAN_END,              // no more input
+		SCAN_BAD               // something other than a number
+	};
+
+	// Buffer handling
+	bool fill();
+	void need(size_t bytes);
+	void skipSpace();
+	Scan readNumber(int &value);
+	bool readLine(string &line);
+	void fail(const string &expected);
+	void finish();
+
+	static const size_t CHUNK = 1 << 20;  // bytes read from in at a time
+
+	istream &in;                          // stream being parsed
+	bool seekable;                        // in can be moved back
+	vector<char> buffer;                  // block of input being scanned
+	size_t pos;                           // next byte of buffer to scan
+	size_t end;                           // bytes of buffer holding input
+	streampos blockStart;                 // position of in before the last
+	                                      // block was read
+	long long blockIndex;                 // buffer index of that block
+	streampos previousStart;              // the same for the block before,
+	long long previousIndex;              // whose tail may still be unscanned
+	bool exhausted;                       // in has nothing more to read
+	int lineNumber;                       // line of buffer[pos], from 1
+	string message;                       // last error
+};
+#endif
\ No newline at end of file
@@ -0,0 +1,421 @@
+//-----------------------------------------------------------------------------
+// File:		landmarks.cpp
+// Programmer:	Anthony Waddell
+// Resources:	Goldberg and Harrelson, Computing the Shortest Path: A* Search
+//					Meets Graph Theory
+//					https://www.microsoft.com/en-us/research/publication/
+//					computing-the-shortest-path-a-search-meets-graph-theory/
+//-----------------------------------------------------------------------------
+#include "landmarks.h"
+#include "dijkstra.h"
+#include <algorithm>
+#include <string.h>
+
+//-----------------------------------------------------------------------------
+// Function:	LandmarkIndex::LandmarkIndex()
+// Title:		Constructor
+// Description: Constructs an index with no landmarks
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		N/A
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+LandmarkIndex::LandmarkIndex()
+{
+	nodes = 0;
+	count = 0;
+	point();
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void LandmarkIndex::build(const CSRGraph &forward,
+//					const CSRGraph &backward, int count,
+//					DijkstraEngine &engine)
+// Title:		Builds the landmarks
+// Description: Picks landmarks by farthest selection: the first is the node
+//					furthest from node 1, and each next one is the node
+//					furthest from its nearest landmark, a node no landmark
+//					reaches counting as furthest. Landmarks spread this way
+//					lie past the edges of the graph, where their bounds are
+//					tightest. Costs from each landmark come from a search
+//					over forward and costs to it from one over backward, so
+//					building costs 2 count searches and 8 count (nodes + 1)
+//					bytes
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	const CSRGraph &forward; edges of each node
+//				const CSRGraph &backward; forward with every edge reversed
+//				int count; landmarks wanted, at most the number of nodes
+//				DijkstraEngine &engine; search used to find the costs
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void LandmarkIndex::build(const CSRGraph &forward, const CSRGraph &backward,
+	int count, DijkstraEngine &engine)
+{
+	clear();
+	nodes = forward.nodeCount();
+	this->count = max(min(count, nodes), 0);
+	if (this->count == 0)
+	{
+		return;
+	}
+	count = this->count;
+	ids.assign(count, 0);
+	from.assign((size_t)(nodes + 1) * count, INT_MAX);
+	to.assign((size_t)(nodes + 1) * count, INT_MAX);
+
+	// Costs from node 1 pick the first landmark, after that the costs from
+	// the nearest landmark so far
+	vector<int> dist;
+	vector<int> path;
+	engine.run(forward, 1, dist, path);
+	vector<int> nearest(dist);
+	vector<bool> chosen(nodes + 1, false);
+	for (int i = 0; i < count; i++)
+	{
+		int best = 0;
+		for (int v = 1; v <= nodes; v++)
+		{
+			if (!chosen[v] && (best == 0 || nearest[v] > nearest[best]))
+			{
+				best = v;
+			}
+		}
+		ids[i] = best;
+		chosen[best] = true;
+
+		engine.run(forward, best, dist, path);
+		for (int v = 1; v <= nodes; v++)
+		{
+			from[(size_t)v * count + i] = dist[v];
+			nearest[v] = (i == 0) ? dist[v] : min(nearest[v], dist[v]);
+		}
+		engine.run(backward, best, dist, path);
+		for (int v = 1; v <= nodes; v++)
+		{
+			to[(size_t)v * count + i] = dist[v];
+		}
+	}
+	point();
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void LandmarkIndex::clear()
+// Title:		Drops the landmarks
+// Description: Frees the costs and closes any loaded file, leaving no
+//					landmarks
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void LandmarkIndex::clear()
+{
+	nodes = 0;
+	count = 0;
+	vector<int>().swap(ids);
+	vector<int>().swap(from);
+	vector<int>().swap(to);
+	file.close();
+	point();
+}
+
+//-----------------------------------------------------------------------------
+// Function:	bool LandmarkIndex::empty() const
+// Title:		Checks for landmarks
+// Description: Returns whether the index has no landmarks, so bound
+//					would always be 0
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		bool; true if there are no landmarks
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+bool LandmarkIndex::empty() const
+{
+	return count == 0;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	int LandmarkIndex::landmarkCount() const
+// Title:		Number of landmarks
+// Description: Returns the number of landmarks
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		int; number of landmarks
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+int LandmarkIndex::landmarkCount() const
+{
+	return count;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	int LandmarkIndex::landmark(int i) const
+// Title:		A landmark node
+// Description: Returns the node of landmark i, in the order they were picked
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int i; landmark number, 0 to landmarkCount() - 1
+// Returns:		int; array index of the landmark node
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+int LandmarkIndex::landmark(int i) const
+{
+	return idData[i];
+}
+
+//-----------------------------------------------------------------------------
+// Function:	int LandmarkIndex::bound(int node, int target) const
+// Title:		Lower bound on a cost
+// Description: Returns the largest of d(L, target) - d(L, node) and
+//					d(node, L) - d(target, L) over every landmark L. Each is
+//					a lower bound by the triangle inequality, and the bound
+//					never drops by more than an edge costs along that edge,
+//					so A* settles each node once. When L reaches node but
+//					not target, or target reaches L but node does not, there
+//					is no path from node to target
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int node; array index of the node searched from
+//				int target; array index of the destination node
+// Returns:		int; lower bound on the cost from node to target, INT_MAX
+//					if target can not be reached, 0 with no landmarks
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+int LandmarkIndex::bound(int node, int target) const
+{
+	const int *fromNode = fromData + (size_t)node * count;
+	const int *fromTarget = fromData + (size_t)target * count;
+	const int *toNode = toData + (size_t)node * count;
+	const int *toTarget = toData + (size_t)target * count;
+	int best = 0;
+	for (int i = 0; i < count; i++)
+	{
+		if (fromNode[i] != INT_MAX)
+		{
+			if (fromTarget[i] == INT_MAX)
+			{
+				return INT_MAX;
+			}
+			best = max(best, fromTarget[i] - fromNode[i]);
+		}
+		if (toTarget[i] != INT_MAX)
+		{
+			if (toNode[i] == INT_MAX)
+			{
+				return INT_MAX;
+			}
+			best = max(best, toNode[i] - toTarget[i]);
+		}
+	}
+	return best;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	bool LandmarkIndex::save(const string &fileName,
+//					uint64_t graphHash) const
+// Title:		Writes a landmark file
+// Description: Writes the header, landmarks and costs to fileName with the
+//					hash of the graph they were found on. Loaded costs are
+//					read from a mapping of their file, so the file is
+//					written under a temporary name and moved over it
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	const string &fileName; file to create or replace
+//				uint64_t graphHash; hash of the graph of the landmarks
+// Returns:		bool; true if the whole file was written, false if there
+//					are no landmarks or the file could not be written
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Writes a temporary file and renames it
+//-----------------------------------------------------------------------------
+bool LandmarkIndex::save(const string &fileName, uint64_t graphHash) const
+{
+	if (count == 0)
+	{
+		return false;
+	}
+	uint64_t costBytes = (uint64_t)(nodes + 1) * count * sizeof(int32_t);
+
+	LandmarkFileHeader header;
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, "DJKLANDS", 8);
+	header.version = LANDMARK_FILE_VERSION;
+	header.byteOrder = 0x01020304;
+	header.nodes = (uint32_t)nodes;
+	header.count = (uint32_t)count;
+	header.graphHash = graphHash;
+	header.landmarkStart = MappedFile::alignUp(sizeof(LandmarkFileHeader));
+	header.fromStart = MappedFile::alignUp(header.landmarkStart
+		+ count * sizeof(int32_t));
+	header.toStart = MappedFile::alignUp(header.fromStart + costBytes);
+	header.fileBytes = header.toStart + costBytes;
+
+	string tempName = MappedFile::tempName(fileName);
+	ofstream out(tempName.c_str(), ios::binary | ios::trunc);
+	if (!out)
+	{
+		return false;
+	}
+	out.write((const char *)&header, sizeof(header));
+	MappedFile::writeSection(out, header.landmarkStart, idData,
+		count * sizeof(int32_t));
+	MappedFile::writeSection(out, header.fromStart, fromData,
+		(size_t)costBytes);
+	MappedFile::writeSection(out, header.toStart, toData, (size_t)costBytes);
+	return MappedFile::replaceFile(out, tempName, fileName);
+}
+
+//-----------------------------------------------------------------------------
+// Function:	bool LandmarkIndex::load(const string &fileName, int nodes,
+//					uint64_t graphHash)
+// Title:		Loads a landmark file
+// Description: Maps a file written by save and reads its costs in place.
+//					The file is only used when it was saved for a graph of
+//					nodes nodes with the same hash. Otherwise the current
+//					landmarks are kept
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	const string &fileName; file written by save
+//				int nodes; number of nodes in the graph
+//				uint64_t graphHash; hash of the graph
+// Returns:		bool; true if the landmarks were loaded
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+bool LandmarkIndex::load(const string &fileName, int nodes,
+	uint64_t graphHash)
+{
+	// Check the file before letting go of the current landmarks
+	{
+		MappedFile candidate;
+		if (!candidate.open(fileName)
+			|| candidate.size() < sizeof(LandmarkFileHeader))
+		{
+			return false;
+		}
+		const LandmarkFileHeader &header =
+			*(const LandmarkFileHeader *)candidate.data();
+		if (!validate(header, candidate.size())
+			|| header.nodes != (uint32_t)nodes
+			|| header.graphHash != graphHash)
+		{
+			return false;
+		}
+	}
+
+	clear();
+	if (!file.open(fileName))
+	{
+		return false;
+	}
+	const LandmarkFileHeader &header =
+		*(const LandmarkFileHeader *)file.data();
+	this->nodes = (int)header.nodes;
+	count = (int)header.count;
+	idData = (const int *)(file.data() + header.landmarkStart);
+	fromData = (const int *)(file.data() + header.fromStart);
+	toData = (const int *)(file.data() + header.toStart);
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	bool LandmarkIndex::validate(
+//					const LandmarkFileHeader &header, size_t length) const
+// Title:		Checks the file layout
+// Description: Checks magic, version and byte order, that every section
+//					lies inside the file on an 8 byte boundary, and that each
+//					landmark is a node. Every cost must be 0 or more, INT_MAX
+//					marking no path, so bound can subtract two costs without
+//					overflow and never gives more than the true cost
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	const LandmarkFileHeader &header; header at the file start
+//				size_t length; bytes in the file
+// Returns:		bool; true if the layout is valid
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Checks costs
+//-----------------------------------------------------------------------------
+bool LandmarkIndex::validate(const LandmarkFileHeader &header,
+	size_t length) const
+{
+	const LandmarkFileHeader &h = header;
+	if (memcmp(h.magic, "DJKLANDS", 8) != 0
+		|| h.version != LANDMARK_FILE_VERSION || h.byteOrder != 0x01020304
+		|| h.fileBytes != length || h.nodes >= (1u << 30) || h.count == 0
+		|| h.count > h.nodes)
+	{
+		return false;
+	}
+
+	// Each section in order, aligned, and long enough for its contents
+	uint64_t costBytes = (uint64_t)(h.nodes + 1) * h.count * sizeof(int32_t);
+	uint64_t starts[3] = { h.landmarkStart, h.fromStart, h.toStart };
+	uint64_t bytes[3] = { (uint64_t)h.count * sizeof(int32_t), costBytes,
+		costBytes };
+	uint64_t end = sizeof(LandmarkFileHeader);
+	for (int i = 0; i < 3; i++)
+	{
+		if (starts[i] % 8 != 0 || starts[i] < end || bytes[i] > length
+			|| starts[i] > length - bytes[i])
+		{
+			return false;
+		}
+		end = starts[i] + bytes[i];
+	}
+
+	const int32_t *landmarks = (const int32_t *)((const char *)&header
+		+ h.landmarkStart);
+	for (uint32_t i = 0; i < h.count; i++)
+	{
+		if (landmarks[i] < 1 || landmarks[i] > (int32_t)h.nodes)
+		{
+			return false;
+		}
+	}
+
+	// Costs from and to the landmarks never below 0
+	const char *base = (const char *)&header;
+	const int32_t *from = (const int32_t *)(base + h.fromStart);
+	const int32_t *to = (const int32_t *)(base + h.toStart);
+	uint64_t cells = (uint64_t)(h.nodes + 1) * h.count;
+	for (uint64_t i = 0; i < cells; i++)
+	{
+		if (from[i] < 0 || to[i] < 0)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void LandmarkIndex::point()
+// Title:		Points at the built costs
+// Description: Sets the arrays in use to the vectors filled by build
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void LandmarkIndex::point()
+{
+	idData = ids.empty() ? NULL : &ids[0];
+	fromData = from.empty() ? NULL : &from[0];
+	toData = to.empty() ? NULL : &to[0];
+}
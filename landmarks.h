@@ -0,0 +1,97 @@
+#ifndef LANDMARKS_H
+#define LANDMARKS_H
+//----------------------------------------------------------------------------
+// File: landmarks.h
+//
+// Description: Function outlines for the LandmarkIndex class, the lowest
+//				costs from and to a few landmark nodes, used as lower bounds
+//				that steer A* point to point searches toward the target
+//				(ALT: A*, landmarks and the triangle inequality). For a
+//				landmark L, the cost from s to t is at least
+//				d(L, t) - d(L, s) and at least d(s, L) - d(t, L).
+//				The costs can be saved to a file that is mapped into memory
+//				and read in place. A file is a LandmarkFileHeader followed
+//				by the sections it locates, each on an 8 byte boundary:
+//					landmarks	int32[count], landmark nodes
+//					from		int32[nodes + 1][count], d(L, v) of node v
+//					to			int32[nodes + 1][count], d(v, L) of node v
+//				with INT_MAX where there is no path. Integers are in the
+//				byte order of the machine that wrote the file
+//
+// Programmer:	Anthony Waddell
+//
+// Environment: Hardware: PC, i7
+//              Software: OS: Windows 10
+//              Compiles under Microsoft Visual C++ 2015, g++
+//-----------------------------------------------------------------------------
+#include "csrgraph.h"
+#include "mappedfile.h"
+#include <limits.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+class DijkstraEngine;
+
+const uint32_t LANDMARK_FILE_VERSION = 1;
+
+// Fixed size start of a landmark file
+struct LandmarkFileHeader
+{
+	char magic[8];             // "DJKLANDS"
+	uint32_t version;          // LANDMARK_FILE_VERSION of the writer
+	uint32_t byteOrder;        // 0x01020304 as stored by the writer
+	uint32_t nodes;            // number of nodes, index 0 not being used
+	uint32_t count;            // number of landmarks
+	uint64_t graphHash;        // GraphM::graphHash of the graph
+	uint64_t landmarkStart;    // file position of each section
+	uint64_t fromStart;
+	uint64_t toStart;
+	uint64_t fileBytes;        // total length of the file
+};
+
+class LandmarkIndex
+{
+public:
+	// Constructor
+	LandmarkIndex();
+
+	// Pick count landmarks and find their costs from and to every node
+	void build(const CSRGraph &forward, const CSRGraph &backward, int count,
+		DijkstraEngine &engine);
+	void clear();
+	bool empty() const;
+
+	// Landmark nodes
+	int landmarkCount() const;
+	int landmark(int i) const;
+
+	// Lower bound on the cost from node to target, INT_MAX if none exists
+	int bound(int node, int target) const;
+
+	// Landmark files, checked against the graph they were built for
+	bool save(const string &fileName, uint64_t graphHash) const;
+	bool load(const string &fileName, int nodes, uint64_t graphHash);
+
+private:
+
+	// Not copyable, a loaded index has one mapping
+	LandmarkIndex(const LandmarkIndex &);
+	LandmarkIndex& operator=(const LandmarkIndex &);
+
+	void point();
+	bool validate(const LandmarkFileHeader &header, size_t length) const;
+
+	int nodes;                            // number of nodes, index 0 unused
+	int count;                            // number of landmarks, 0 if none
+	vector<int> ids;                      // landmark nodes
+	vector<int> from;                     // d(L, v), count per node
+	vector<int> to;                       // d(v, L), count per node
+	MappedFile file;                      // loaded file, if any
+	const int *idData;                    // landmarks in use
+	const int *fromData;                  // costs from landmarks in use
+	const int *toData;                    // costs to landmarks in use
+};
+#endif
@@ -0,0 +1,304 @@
+//-----------------------------------------------------------------------------
+// File:		mappedfile.cpp
+// Programmer:	Anthony Waddell
+// Resources:	http://man7.org/linux/man-pages/man2/mmap.2.html
+//				https://docs.microsoft.com/en-us/windows/win32/memory/
+//					creating-a-view-within-a-file
+//-----------------------------------------------------------------------------
+#include "mappedfile.h"
+#include <stdio.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+//-----------------------------------------------------------------------------
+// Function:	MappedFile::MappedFile()
+// Title:		Constructor
+// Description: Constructs a closed file
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		N/A
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+MappedFile::MappedFile()
+{
+	base = NULL;
+	length = 0;
+	mapped = false;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	MappedFile::~MappedFile()
+// Title:		Destructor
+// Description: Releases the mapping, if open
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		N/A
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+MappedFile::~MappedFile()
+{
+	close();
+}
+
+//-----------------------------------------------------------------------------
+// Function:	bool MappedFile::open(const string &fileName)
+// Title:		Maps a file
+// Description: Maps all of fileName read only, with mmap or on Windows
+//					with a file mapping object and a view of it. Nothing is
+//					copied, so opening costs the same for any size of file.
+//					The handles are closed once the view exists, as the view
+//					keeps the mapping open
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	const string &fileName; file to open
+// Returns:		bool; true if the file exists and is not empty
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Moved from GraphFile::open
+//				10/17/26 AW Maps the file on Windows instead of reading it
+//-----------------------------------------------------------------------------
+bool MappedFile::open(const string &fileName)
+{
+	close();
+#ifdef _WIN32
+	HANDLE handle = CreateFileA(fileName.c_str(), GENERIC_READ,
+		FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (handle == INVALID_HANDLE_VALUE)
+	{
+		return false;
+	}
+	LARGE_INTEGER bytes;
+	if (!GetFileSizeEx(handle, &bytes) || bytes.QuadPart <= 0
+		|| (unsigned long long)bytes.QuadPart > (size_t)-1)
+	{
+		CloseHandle(handle);
+		return false;
+	}
+	HANDLE mapping = CreateFileMappingA(handle, NULL, PAGE_READONLY, 0, 0,
+		NULL);
+	CloseHandle(handle);
+	if (mapping == NULL)
+	{
+		return false;
+	}
+	void *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	CloseHandle(mapping);
+	if (view == NULL)
+	{
+		return false;
+	}
+	base = (const char *)view;
+	length = (size_t)bytes.QuadPart;
+	mapped = true;
+#else
+	int fd = ::open(fileName.c_str(), O_RDONLY);
+	if (fd < 0)
+	{
+		return false;
+	}
+	struct stat info;
+	if (fstat(fd, &info) != 0 || info.st_size <= 0)
+	{
+		::close(fd);
+		return false;
+	}
+	void *view = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	::close(fd);
+	if (view == MAP_FAILED)
+	{
+		return false;
+	}
+	base = (const char *)view;
+	length = (size_t)info.st_size;
+	mapped = true;
+#endif
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void MappedFile::close()
+// Title:		Closes the file
+// Description: Releases the mapping. Pointers into the file must not be
+//					used after this
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Moved from GraphFile::close
+//				10/17/26 AW Unmaps the view on Windows
+//-----------------------------------------------------------------------------
+void MappedFile::close()
+{
+	if (mapped)
+	{
+#ifdef _WIN32
+		UnmapViewOfFile(base);
+#else
+		munmap((void *)base, length);
+#endif
+	}
+	base = NULL;
+	length = 0;
+	mapped = false;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	bool MappedFile::isOpen() const
+// Title:		Checks for an open file
+// Description: Returns whether a file is mapped
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		bool; true if open
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+bool MappedFile::isOpen() const
+{
+	return base != NULL;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	const char *MappedFile::data() const
+// Title:		Contents of the file
+// Description: Returns the first byte of the open file
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		const char *; start of the file, NULL if not open
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+const char *MappedFile::data() const
+{
+	return base;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	size_t MappedFile::size() const
+// Title:		Length of the file
+// Description: Returns the number of bytes in the open file
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		size_t; length, 0 if not open
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+size_t MappedFile::size() const
+{
+	return length;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	uint64_t MappedFile::alignUp(uint64_t position)
+// Title:		Rounds up to a section boundary
+// Description: Rounds position up to the next multiple of 8
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	uint64_t position; file position
+// Returns:		uint64_t; aligned position
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Moved from graphfile.cpp
+//-----------------------------------------------------------------------------
+uint64_t MappedFile::alignUp(uint64_t position)
+{
+	return (position + 7) & ~(uint64_t)7;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void MappedFile::writeSection(ofstream &out, uint64_t start,
+//					const void *data, size_t bytes)
+// Title:		Writes one section
+// Description: Pads the file with zeros up to start and writes the section
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	ofstream &out; file being written
+//				uint64_t start; position of the section
+//				const void *data; contents of the section
+//				size_t bytes; length of the section
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Moved from graphfile.cpp
+//-----------------------------------------------------------------------------
+void MappedFile::writeSection(ofstream &out, uint64_t start, const void *data,
+	size_t bytes)
+{
+	static const char zeros[8] = { 0 };
+	uint64_t position = (uint64_t)out.tellp();
+	out.write(zeros, (streamsize)(start - position));
+	if (bytes > 0)
+	{
+		out.write((const char *)data, (streamsize)bytes);
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Function:	string MappedFile::tempName(const string &fileName)
+// Title:		Name to write a file under
+// Description: Returns the name a new fileName is written under before
+//					replaceFile moves it into place
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	const string &fileName; file to create or replace
+// Returns:		string; fileName with .tmp added
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+string MappedFile::tempName(const string &fileName)
+{
+	return fileName + ".tmp";
+}
+
+//-----------------------------------------------------------------------------
+// Function:	bool MappedFile::replaceFile(ofstream &out,
+//					const string &tempName, const string &fileName)
+// Title:		Moves a written file into place
+// Description: Closes out, written under tempName, and renames it over
+//					fileName. Truncating a file that is mapped, possibly
+//					the one the data being written is read from, would make
+//					reads of the lost pages fault, so files are never
+//					written in place. A mapping of the old file keeps its
+//					contents. Windows does not replace a file that is
+//					mapped, so there saving over an open file fails. The
+//					temporary file is removed on failure
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	ofstream &out; stream writing tempName
+//				const string &tempName; name the file was written under
+//				const string &fileName; file to create or replace
+// Returns:		bool; true if the file was written and moved into place
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+bool MappedFile::replaceFile(ofstream &out, const string &tempName,
+	const string &fileName)
+{
+	out.close();
+	bool written = !out.fail();
+#ifdef _WIN32
+	written = written && MoveFileExA(tempName.c_str(), fileName.c_str(),
+		MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+	written = written && rename(tempName.c_str(), fileName.c_str()) == 0;
+#endif
+	if (!written)
+	{
+		remove(tempName.c_str());
+	}
+	return written;
+}
@@ -0,0 +1,62 @@
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+//----------------------------------------------------------------------------
+// File: mappedfile.h
+//
+// Description: Function outlines for the MappedFile class, a whole file
+//				mapped read only into memory, with mmap or on Windows
+//				MapViewOfFile. Also lays out files for mapping, each section
+//				starting on an 8 byte boundary
+//
+// Programmer:	Anthony Waddell
+//
+// Environment: Hardware: PC, i7
+//              Software: OS: Windows 10
+//              Compiles under Microsoft Visual C++ 2015, g++
+//-----------------------------------------------------------------------------
+#include <fstream>
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+class MappedFile
+{
+public:
+	// Constructor and destructor
+	MappedFile();
+	~MappedFile();
+
+	// Map a file, close releases the mapping
+	bool open(const string &fileName);
+	void close();
+	bool isOpen() const;
+
+	// Contents of the open file
+	const char *data() const;
+	size_t size() const;
+
+	// Writing a file in 8 byte aligned sections
+	static uint64_t alignUp(uint64_t position);
+	static void writeSection(ofstream &out, uint64_t start, const void *data,
+		size_t bytes);
+
+	// Writing under a temporary name, then replacing the file, so a
+	// mapping of the old file stays readable while the new one is written
+	static string tempName(const string &fileName);
+	static bool replaceFile(ofstream &out, const string &tempName,
+		const string &fileName);
+
+private:
+
+	// Not copyable, the mapping has one owner
+	MappedFile(const MappedFile &);
+	MappedFile& operator=(const MappedFile &);
+
+	const char *base;                     // start of the file in memory
+	size_t length;                        // bytes mapped
+	bool mapped;                          // base is a mapped view
+};
+#endif
@@ -0,0 +1,469 @@
+//-----------------------------------------------------------------------------
+// File:		nametable.cpp
+// Programmer:	Anthony Waddell
+// Resources:	http://www.isthe.com/chongo/tech/comp/fnv/
+//-----------------------------------------------------------------------------
+#include "nametable.h"
+#include <string.h>
+
+//-----------------------------------------------------------------------------
+// Function:	NameTable::NameTable()
+// Title:		Constructor
+// Description: Constructs a table with no nodes
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		N/A
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+NameTable::NameTable()
+{
+	slotMask = 0;
+	clear();
+}
+
+//-----------------------------------------------------------------------------
+// Function:	NameTable::NameTable(const NameTable &other)
+// Title:		Copy constructor
+// Description: Constructs a copy of other
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	const NameTable &other; table to copy
+// Returns:		N/A
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+NameTable::NameTable(const NameTable &other)
+{
+	slotMask = 0;
+	clear();
+	*this = other;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	NameTable& NameTable::operator=(const NameTable &other)
+// Title:		Assignment operator
+// Description: Copies other. Owned names are copied, attached names are
+//					shared with other
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	const NameTable &other; table to copy
+// Returns:		NameTable&; this table
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+NameTable& NameTable::operator=(const NameTable &other)
+{
+	if (this != &other)
+	{
+		nodes = other.nodes;
+		index = other.index;
+		text = other.text;
+		owned = other.owned;
+		indexData = other.indexData;
+		textPointer = other.textPointer;
+		slots = other.slots;
+		slotMask = other.slotMask;
+		if (owned)
+		{
+			point();
+		}
+	}
+	return *this;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void NameTable::clear()
+// Title:		Empties the table
+// Description: Removes every name and the hash index
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void NameTable::clear()
+{
+	nodes = 0;
+	index.assign(2, 0);
+	text.clear();
+	owned = true;
+	slots.clear();
+	slotMask = 0;
+	point();
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void NameTable::reserve(int nodes, size_t bytes)
+// Title:		Makes room
+// Description: Sizes the table for nodes names of bytes characters in all,
+//					so adding them allocates nothing
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int nodes; number of names expected
+//				size_t bytes; total length of the names expected
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void NameTable::reserve(int nodes, size_t bytes)
+{
+	index.reserve(nodes + 2);
+	text.reserve(bytes);
+}
+
+//-----------------------------------------------------------------------------
+// Function:	int NameTable::add(const char *name, size_t length)
+// Title:		Adds a name
+// Description: Appends the name of the next node. Attached names are first
+//					copied so they can grow, and the hash index is dropped
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	const char *name; first character of the name
+//				size_t length; length of the name
+// Returns:		int; the node given the name
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+int NameTable::add(const char *name, size_t length)
+{
+	if (!owned)
+	{
+		index.assign(indexData, indexData + nodes + 2);
+		text.assign(textPointer, indexData[nodes + 1]);
+		owned = true;
+	}
+	text.append(name, length);
+	nodes++;
+	index.push_back((uint32_t)text.size());
+	slots.clear();
+	slotMask = 0;
+	point();
+	return nodes;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void NameTable::attach(int nodes, const uint32_t *index,
+//					const char *text)
+// Title:		Attaches names held elsewhere
+// Description: Makes the table read names in place, for example from a
+//					mapped graph file, without copying them
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int nodes; number of names
+//				const uint32_t *index; nodes + 2 name starts
+//				const char *text; names back to back
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void NameTable::attach(int nodes, const uint32_t *index, const char *text)
+{
+	clear();
+	this->nodes = nodes;
+	owned = false;
+	indexData = index;
+	textPointer = text;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	int NameTable::nodeCount() const
+// Title:		Number of names
+// Description: Returns the number of nodes named, not counting node 0
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		int; number of nodes
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+int NameTable::nodeCount() const
+{
+	return nodes;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	const char *NameTable::name(int node, size_t &length) const
+// Title:		Name of a node
+// Description: Returns the name of node in place
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int node; node from 0 to nodeCount()
+//				size_t &length; set to the length of the name
+// Returns:		const char *; first character of the name, not terminated
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+const char *NameTable::name(int node, size_t &length) const
+{
+	length = indexData[node + 1] - indexData[node];
+	return textPointer + indexData[node];
+}
+
+//-----------------------------------------------------------------------------
+// Function:	string NameTable::nameString(int node) const
+// Title:		Name of a node as a string
+// Description: Returns a copy of the name of node
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int node; node from 0 to nodeCount()
+// Returns:		string; the name
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+string NameTable::nameString(int node) const
+{
+	size_t length = 0;
+	const char *start = name(node, length);
+	return string(start, length);
+}
+
+//-----------------------------------------------------------------------------
+// Function:	const uint32_t *NameTable::indexArray() const
+// Title:		Name starts
+// Description: Returns the nodeCount() + 2 starts of the names in the text
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		const uint32_t *; start of each name
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+const uint32_t *NameTable::indexArray() const
+{
+	return indexData;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	const char *NameTable::textData() const
+// Title:		Name text
+// Description: Returns the names back to back
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		const char *; first character of node 1
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+const char *NameTable::textData() const
+{
+	return textPointer;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	size_t NameTable::textBytes() const
+// Title:		Length of the text
+// Description: Returns the total length of all names
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		size_t; bytes of text
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+size_t NameTable::textBytes() const
+{
+	return indexData[nodes + 1];
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void NameTable::buildIndex()
+// Title:		Builds the hash index
+// Description: Hashes every name into an open addressed table at most half
+//					full. When names repeat the lowest node keeps the name,
+//					as a scan from node 1 would find
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void NameTable::buildIndex()
+{
+	size_t count = 2;
+	while (count < (size_t)nodes * 2)
+	{
+		count *= 2;
+	}
+	slots.assign(count, 0);
+	slotMask = (uint32_t)(count - 1);
+	for (int node = 1; node <= nodes; node++)
+	{
+		size_t length = 0;
+		const char *start = key(node, length);
+		uint32_t slot = hash(start, length) & slotMask;
+		while (slots[slot] != 0)
+		{
+			size_t otherLength = 0;
+			const char *other = key(slots[slot], otherLength);
+			if (otherLength == length && memcmp(other, start, length) == 0)
+			{
+				break;
+			}
+			slot = (slot + 1) & slotMask;
+		}
+		if (slots[slot] == 0)
+		{
+			slots[slot] = node;
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Function:	bool NameTable::hasIndex() const
+// Title:		Index built
+// Description: Tells whether find uses the hash index
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		bool; true if the index is current
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+bool NameTable::hasIndex() const
+{
+	return !slots.empty();
+}
+
+//-----------------------------------------------------------------------------
+// Function:	int NameTable::find(const char *name, size_t length) const
+// Title:		Finds a node by name
+// Description: Probes the hash index, or compares every name in node order
+//					when no index has been built. A carriage return ending
+//					name or a node's name is not compared
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	const char *name; first character of the name
+//				size_t length; length of the name
+// Returns:		int; the lowest node with the name, 0 if none
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+int NameTable::find(const char *name, size_t length) const
+{
+	length = keyLength(name, length);
+	if (slots.empty())
+	{
+		for (int node = 1; node <= nodes; node++)
+		{
+			size_t nodeLength = 0;
+			const char *start = key(node, nodeLength);
+			if (nodeLength == length && memcmp(start, name, length) == 0)
+			{
+				return node;
+			}
+		}
+		return 0;
+	}
+	uint32_t slot = hash(name, length) & slotMask;
+	while (slots[slot] != 0)
+	{
+		size_t nodeLength = 0;
+		const char *start = key(slots[slot], nodeLength);
+		if (nodeLength == length && memcmp(start, name, length) == 0)
+		{
+			return slots[slot];
+		}
+		slot = (slot + 1) & slotMask;
+	}
+	return 0;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	int NameTable::find(const string &name) const
+// Title:		Finds a node by name
+// Description: Finds the node named name
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	const string &name; name to find
+// Returns:		int; the lowest node with the name, 0 if none
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+int NameTable::find(const string &name) const
+{
+	return find(name.data(), name.size());
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void NameTable::point()
+// Title:		Points at owned names
+// Description: Points the name pointers at the owned vectors
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void NameTable::point()
+{
+	indexData = &index[0];
+	textPointer = text.data();
+}
+
+//-----------------------------------------------------------------------------
+// Function:	const char *NameTable::key(int node, size_t &length) const
+// Title:		Lookup key of a node
+// Description: Returns the name of node as compared by lookups
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int node; node from 0 to nodeCount()
+//				size_t &length; set to the length of the key
+// Returns:		const char *; first character of the key
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+const char *NameTable::key(int node, size_t &length) const
+{
+	const char *start = name(node, length);
+	length = keyLength(start, length);
+	return start;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	size_t NameTable::keyLength(const char *name, size_t length)
+// Title:		Length of a lookup key
+// Description: Drops a carriage return ending name
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	const char *name; first character of the name
+//				size_t length; length of the name
+// Returns:		size_t; length compared by lookups
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+size_t NameTable::keyLength(const char *name, size_t length)
+{
+	if (length > 0 && name[length - 1] == '\r')
+	{
+		return length - 1;
+	}
+	return length;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	uint32_t NameTable::hash(const char *name, size_t length)
+// Title:		Hashes a name
+// Description: FNV-1a hash of the bytes of name
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	const char *name; first character of the name
+//				size_t length; length of the name
+// Returns:		uint32_t; the hash
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+uint32_t NameTable::hash(const char *name, size_t length)
+{
+	uint32_t value = 2166136261u;
+	for (size_t i = 0; i < length; i++)
+	{
+		value ^= (unsigned char)name[i];
+		value *= 16777619u;
+	}
+	return value;
+}
@@ -0,0 +1,71 @@
+#ifndef NAMETABLE_H
+#define NAMETABLE_H
+//----------------------------------------------------------------------------
+// File: nametable.h
+//
+// Description: Function outlines for the NameTable class, which stores the
+//				names of all nodes back to back in one block of text. Name i
+//				is the bytes from index[i] to index[i + 1], node 0 having
+//				an empty name, the same layout as a graph file, so a table
+//				can also be attached to names held elsewhere. An optional
+//				hash index finds the node with a given name. Lookups ignore
+//				a carriage return ending a name, which names read from
+//				files with Windows line endings keep
+//
+// Programmer:	Anthony Waddell
+//
+// Environment: Hardware: PC, i7
+//              Software: OS: Windows 10
+//              Compiles under Microsoft Visual C++ 2015, g++
+//-----------------------------------------------------------------------------
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+class NameTable
+{
+public:
+	// Constructors and assignment
+	NameTable();
+	NameTable(const NameTable &other);
+	NameTable& operator=(const NameTable &other);
+
+	// Fill the table, add appends the name of the next node
+	void clear();
+	void reserve(int nodes, size_t bytes);
+	int add(const char *name, size_t length);
+	void attach(int nodes, const uint32_t *index, const char *text);
+
+	// Contents
+	int nodeCount() const;
+	const char *name(int node, size_t &length) const;
+	string nameString(int node) const;
+	const uint32_t *indexArray() const;
+	const char *textData() const;
+	size_t textBytes() const;
+
+	// Name to node lookup, hashed once buildIndex has been called
+	void buildIndex();
+	bool hasIndex() const;
+	int find(const char *name, size_t length) const;
+	int find(const string &name) const;
+
+private:
+	void point();
+	const char *key(int node, size_t &length) const;
+	static size_t keyLength(const char *name, size_t length);
+	static uint32_t hash(const char *name, size_t length);
+
+	int nodes;                            // number of names, index 0 unused
+	vector<uint32_t> index;               // owned start of each name
+	string text;                          // owned names
+	bool owned;                           // true if the vectors are in use
+	const uint32_t *indexData;            // start of each name
+	const char *textPointer;              // names back to back
+	vector<int> slots;                    // hash slots, 0 when empty
+	uint32_t slotMask;                    // slots.size() - 1
+};
+#endif
@@ -0,0 +1,317 @@
+//-----------------------------------------------------------------------------
+// File:		pathheap.cpp
+// Programmer:	Anthony Waddell
+// Resources:	For RadixHeap
+//					Ahuja, Mehlhorn, Orlin, Tarjan, "Faster algorithms for the
+//					shortest path problem", J. ACM 37(2), 1990
+//-----------------------------------------------------------------------------
+#include "pathheap.h"
+
+//-----------------------------------------------------------------------------
+// Function:	BinaryHeap::BinaryHeap()
+// Title:		Constructor
+// Description: Constructs an empty binary heap
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		N/A
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+BinaryHeap::BinaryHeap()
+{
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void BinaryHeap::push(int key, int vertex)
+// Title:		Inserts an entry
+// Description: Appends entry to the end of the heap array and sifts it up
+//					until its parent has a smaller or equal key
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int key; distance of the vertex from the source
+//				int vertex; the vertex being queued
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void BinaryHeap::push(int key, int vertex)
+{
+	int child = (int)heap.size();
+	heap.push_back(HeapEntry());
+
+	// Move parents down until the hole is where the new entry belongs
+	while (child > 0)
+	{
+		int parent = (child - 1) / 2;
+		if (heap[parent].key <= key)
+		{
+			break;
+		}
+		heap[child] = heap[parent];
+		child = parent;
+	}
+	heap[child].key = key;
+	heap[child].vertex = vertex;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	bool BinaryHeap::pop(int &key, int &vertex)
+// Title:		Removes the minimum entry
+// Description: Removes the root of the heap, moves the last entry into its
+//					place and sifts it down
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int &key; set to the smallest key in the heap
+//				int &vertex; set to the vertex with that key
+// Returns:		bool; true if an entry was removed, false if heap was empty
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+bool BinaryHeap::pop(int &key, int &vertex)
+{
+	if (heap.empty())
+	{
+		return false;
+	}
+	key = heap[0].key;
+	vertex = heap[0].vertex;
+
+	HeapEntry moved = heap.back();
+	heap.pop_back();
+	int count = (int)heap.size();
+	int parent = 0;
+
+	// Move smaller children up until the hole is where moved belongs
+	while (true)
+	{
+		int child = 2 * parent + 1;
+		if (child >= count)
+		{
+			break;
+		}
+		if (child + 1 < count && heap[child + 1].key < heap[child].key)
+		{
+			child++;
+		}
+		if (moved.key <= heap[child].key)
+		{
+			break;
+		}
+		heap[parent] = heap[child];
+		parent = child;
+	}
+	if (count > 0)
+	{
+		heap[parent] = moved;
+	}
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	int BinaryHeap::topKey() const
+// Title:		Smallest key
+// Description: Returns the smallest key without removing it
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		int; smallest key, INT_MAX if heap is empty
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+int BinaryHeap::topKey() const
+{
+	return heap.empty() ? INT_MAX : heap[0].key;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	bool BinaryHeap::empty() const
+// Title:		Checks for entries
+// Description: Returns whether the heap has no entries
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		bool; true if heap is empty
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+bool BinaryHeap::empty() const
+{
+	return heap.empty();
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void BinaryHeap::clear()
+// Title:		Removes all entries
+// Description: Removes all entries, keeping the allocated capacity so the
+//					heap can be reused for the next source without allocating
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void BinaryHeap::clear()
+{
+	heap.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Function:	RadixHeap::RadixHeap()
+// Title:		Constructor
+// Description: Constructs an empty radix heap
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		N/A
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+RadixHeap::RadixHeap()
+{
+	last = 0;
+	count = 0;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	int RadixHeap::bucketOf(int key) const
+// Title:		Finds bucket of a key
+// Description: Bucket 0 holds keys equal to the last popped key, bucket i
+//					holds keys whose highest bit differing from it is bit i-1
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int key; key to place, never less than the last popped key
+// Returns:		int; index of the bucket
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+int RadixHeap::bucketOf(int key) const
+{
+	unsigned int diff = (unsigned int)key ^ last;
+	if (diff == 0)
+	{
+		return 0;
+	}
+#if defined(__GNUC__)
+	return 32 - __builtin_clz(diff);
+#else
+	int bucket = 0;
+	while (diff != 0)
+	{
+		diff >>= 1;
+		bucket++;
+	}
+	return bucket;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void RadixHeap::push(int key, int vertex)
+// Title:		Inserts an entry
+// Description: Appends entry to the bucket matching its key
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int key; distance of the vertex from the source
+//				int vertex; the vertex being queued
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void RadixHeap::push(int key, int vertex)
+{
+	HeapEntry entry;
+	entry.key = key;
+	entry.vertex = vertex;
+	buckets[bucketOf(key)].push_back(entry);
+	count++;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	bool RadixHeap::pop(int &key, int &vertex)
+// Title:		Removes the minimum entry
+// Description: If no key equals the last popped key, finds the first non
+//					empty bucket, makes its minimum the new last key and
+//					redistributes that bucket into the lower buckets. Every
+//					entry only ever moves to lower buckets, so the total work
+//					is bounded by 33 moves per entry
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int &key; set to the smallest key in the heap
+//				int &vertex; set to the vertex with that key
+// Returns:		bool; true if an entry was removed, false if heap was empty
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+bool RadixHeap::pop(int &key, int &vertex)
+{
+	if (count == 0)
+	{
+		return false;
+	}
+
+	// Refill bucket 0 from the first non empty bucket
+	if (buckets[0].empty())
+	{
+		int i = 1;
+		while (buckets[i].empty())
+		{
+			i++;
+		}
+		unsigned int minimum = (unsigned int)buckets[i][0].key;
+		for (size_t j = 1; j < buckets[i].size(); j++)
+		{
+			minimum = min(minimum, (unsigned int)buckets[i][j].key);
+		}
+		last = minimum;
+		for (size_t j = 0; j < buckets[i].size(); j++)
+		{
+			buckets[bucketOf(buckets[i][j].key)].push_back(buckets[i][j]);
+		}
+		buckets[i].clear();
+	}
+
+	key = buckets[0].back().key;
+	vertex = buckets[0].back().vertex;
+	buckets[0].pop_back();
+	count--;
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	bool RadixHeap::empty() const
+// Title:		Checks for entries
+// Description: Returns whether the heap has no entries
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		bool; true if heap is empty
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+bool RadixHeap::empty() const
+{
+	return count == 0;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void RadixHeap::clear()
+// Title:		Removes all entries
+// Description: Removes all entries and resets the last popped key, keeping
+//					bucket capacity for reuse
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void RadixHeap::clear()
+{
+	for (int i = 0; i < BUCKETS; i++)
+	{
+		buckets[i].clear();
+	}
+	last = 0;
+	count = 0;
+}
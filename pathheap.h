@@ -0,0 +1,80 @@
+#ifndef PATHHEAP_H
+#define PATHHEAP_H
+//----------------------------------------------------------------------------
+// File: pathheap.h
+//
+// Description: Priority queues used by the Dijkstra engine to pick the next
+//				lowest cost vertex. Both heaps store (distance, vertex) pairs
+//				and use lazy deletion: a vertex may be pushed more than once
+//				and stale entries are skipped by the caller when popped
+//
+// Programmer:	Anthony Waddell
+//
+// Environment: Hardware: PC, i7
+//              Software: OS: Windows 10
+//              Compiles under Microsoft Visual C++ 2015, g++
+//-----------------------------------------------------------------------------
+#include <algorithm>
+#include <limits.h>
+#include <vector>
+
+using namespace std;
+
+// Binary min heap keyed on distance, general purpose
+class BinaryHeap
+{
+public:
+	// Constructor
+	BinaryHeap();
+
+	// Heap operations
+	void push(int key, int vertex);
+	bool pop(int &key, int &vertex);
+	int topKey() const;
+	bool empty() const;
+	void clear();
+
+private:
+
+	// Entry stored in the heap array
+	struct HeapEntry
+	{
+		int key;               // distance from source
+		int vertex;            // vertex reached with that distance
+	};
+
+	vector<HeapEntry> heap;                // implicit binary tree, root at 0
+};
+
+// Radix heap for non-negative integer keys popped in non-decreasing order,
+// which always holds for Dijkstra with non-negative edge weights
+class RadixHeap
+{
+public:
+	// Constructor
+	RadixHeap();
+
+	// Heap operations
+	void push(int key, int vertex);
+	bool pop(int &key, int &vertex);
+	bool empty() const;
+	void clear();
+
+private:
+
+	// Entry stored in a bucket
+	struct HeapEntry
+	{
+		int key;               // distance from source
+		int vertex;            // vertex reached with that distance
+	};
+
+	// Bucket index of key relative to the last popped key
+	int bucketOf(int key) const;
+
+	static const int BUCKETS = 33;         // one per bit of key, plus equal
+	vector<HeapEntry> buckets[BUCKETS];    // entries grouped by highest bit
+	unsigned int last;                     // last key popped
+	int count;                             // number of entries in the heap
+};
+#endif
\ No newline at end of file
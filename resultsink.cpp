@@ -0,0 +1,421 @@
+//-----------------------------------------------------------------------------
+// File:		resultsink.cpp
+// Programmer:	Anthony Waddell
+// Resources:	N/A
+//-----------------------------------------------------------------------------
+#include "resultsink.h"
+#include <stdint.h>
+
+//-----------------------------------------------------------------------------
+// Function:	ResultSink::~ResultSink()
+// Title:		Destructor
+// Description: Virtual destructor so sinks can be deleted through the base
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		N/A
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+ResultSink::~ResultSink()
+{
+}
+
+//-----------------------------------------------------------------------------
+// Function:	BufferedWriter::BufferedWriter(ostream &out)
+// Title:		Constructor
+// Description: Constructs a writer that buffers output for out
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	ostream &out; stream to write to
+// Returns:		N/A
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+BufferedWriter::BufferedWriter(ostream &out) : out(out)
+{
+	buffer.reserve(BLOCK + 4096);
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void BufferedWriter::spill()
+// Title:		Writes a full buffer
+// Description: Hands the buffer to the stream once it holds a block, without
+//					flushing the stream
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void BufferedWriter::spill()
+{
+	if (buffer.size() >= BLOCK)
+	{
+		out.write(buffer.data(), (streamsize)buffer.size());
+		buffer.clear();
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void BufferedWriter::finish()
+// Title:		Writes remaining output
+// Description: Writes what is left in the buffer and flushes the stream,
+//					the only flush a writer makes
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void BufferedWriter::finish()
+{
+	out.write(buffer.data(), (streamsize)buffer.size());
+	buffer.clear();
+	out.flush();
+}
+
+//-----------------------------------------------------------------------------
+// Function:	TextResultWriter::TextResultWriter(ostream &out)
+// Title:		Constructor
+// Description: Constructs a text writer and buffers the column headings
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	ostream &out; stream to write to
+// Returns:		N/A
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+TextResultWriter::TextResultWriter(ostream &out) : BufferedWriter(out)
+{
+	buffer.append("Description");
+	appendField("From node", 18);
+	appendField("To node", 10);
+	appendField("Djikstra's", 13);
+	appendField("Path", 9);
+	buffer.push_back('\n');
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void TextResultWriter::beginSource(int source,
+//					const char *name, size_t length)
+// Title:		Starts a source
+// Description: Writes the name of the source node on its own line
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int source; array index of the source node
+//				const char *name; name of the source node, not terminated
+//				size_t length; length of the name
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void TextResultWriter::beginSource(int /* source */, const char *name,
+	size_t length)
+{
+	buffer.append(name, length);
+	buffer.push_back('\n');
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void TextResultWriter::pathRow(int source, int destination,
+//					int dist, const vector<int> &nodes)
+// Title:		Writes one row
+// Description: Writes source and destination indices, then the cost and path
+//					or ---- if no path exists, in the displayAll columns
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int source; array index of the source node
+//				int destination; array index of the destination node
+//				int dist; lowest cost, INT_MAX if no path exists
+//				const vector<int> &nodes; the path, source first
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void TextResultWriter::pathRow(int source, int destination, int dist,
+	const vector<int> &nodes)
+{
+	appendField(source, 25);
+	appendField(destination, 10);
+	if (dist != INT_MAX)
+	{
+		appendField(dist, 10);
+		if (!nodes.empty())
+		{
+			buffer.append("\t\t");
+			for (size_t i = 0; i < nodes.size(); i++)
+			{
+				buffer.push_back(' ');
+				buffer.append(to_string(nodes[i]));
+			}
+		}
+	}
+	else
+	{
+		appendField("----", 10);
+	}
+	buffer.push_back('\n');
+	spill();
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void TextResultWriter::endSource(int source)
+// Title:		Ends a source
+// Description: Writes the blank line after the rows of a source
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int source; array index of the source node
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void TextResultWriter::endSource(int /* source */)
+{
+	buffer.push_back('\n');
+	spill();
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void TextResultWriter::appendField(const string &text,
+//					int width)
+// Title:		Appends a right aligned field
+// Description: Appends text padded on the left to width, like setw
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	const string &text; field contents
+//				int width; minimum field width
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void TextResultWriter::appendField(const string &text, int width)
+{
+	if ((int)text.size() < width)
+	{
+		buffer.append(width - text.size(), ' ');
+	}
+	buffer.append(text);
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void TextResultWriter::appendField(int value, int width)
+// Title:		Appends a right aligned number
+// Description: Appends value padded on the left to width, like setw
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int value; field contents
+//				int width; minimum field width
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void TextResultWriter::appendField(int value, int width)
+{
+	char digits[16];
+	int count = 0;
+	unsigned int rest = value < 0 ? 0u - (unsigned int)value : value;
+	do
+	{
+		digits[count++] = (char)('0' + rest % 10);
+		rest /= 10;
+	} while (rest != 0);
+	if (value < 0)
+	{
+		digits[count++] = '-';
+	}
+	if (count < width)
+	{
+		buffer.append(width - count, ' ');
+	}
+	while (count > 0)
+	{
+		buffer.push_back(digits[--count]);
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Function:	CsvResultWriter::CsvResultWriter(ostream &out)
+// Title:		Constructor
+// Description: Constructs a CSV writer and buffers the heading line
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	ostream &out; stream to write to
+// Returns:		N/A
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+CsvResultWriter::CsvResultWriter(ostream &out) : BufferedWriter(out)
+{
+	buffer.append("source,destination,dist,path\n");
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void CsvResultWriter::beginSource(int source,
+//					const char *name, size_t length)
+// Title:		Starts a source
+// Description: Nothing to write, rows carry their source
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int source; array index of the source node
+//				const char *name; name of the source node, not terminated
+//				size_t length; length of the name
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void CsvResultWriter::beginSource(int /* source */, const char * /* name */,
+	size_t /* length */)
+{
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void CsvResultWriter::pathRow(int source, int destination,
+//					int dist, const vector<int> &nodes)
+// Title:		Writes one row
+// Description: Writes one CSV line for the row
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int source; array index of the source node
+//				int destination; array index of the destination node
+//				int dist; lowest cost, INT_MAX if no path exists
+//				const vector<int> &nodes; the path, source first
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void CsvResultWriter::pathRow(int source, int destination, int dist,
+	const vector<int> &nodes)
+{
+	buffer.append(to_string(source));
+	buffer.push_back(',');
+	buffer.append(to_string(destination));
+	buffer.push_back(',');
+	if (dist != INT_MAX)
+	{
+		buffer.append(to_string(dist));
+	}
+	buffer.push_back(',');
+	for (size_t i = 0; i < nodes.size(); i++)
+	{
+		if (i > 0)
+		{
+			buffer.push_back(' ');
+		}
+		buffer.append(to_string(nodes[i]));
+	}
+	buffer.push_back('\n');
+	spill();
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void CsvResultWriter::endSource(int source)
+// Title:		Ends a source
+// Description: Nothing to write
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int source; array index of the source node
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void CsvResultWriter::endSource(int /* source */)
+{
+}
+
+//-----------------------------------------------------------------------------
+// Function:	BinaryResultWriter::BinaryResultWriter(ostream &out)
+// Title:		Constructor
+// Description: Constructs a binary writer
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	ostream &out; stream to write to, opened binary
+// Returns:		N/A
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+BinaryResultWriter::BinaryResultWriter(ostream &out) : BufferedWriter(out)
+{
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void BinaryResultWriter::beginSource(int source,
+//					const char *name, size_t length)
+// Title:		Starts a source
+// Description: Nothing to write, records carry their source
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int source; array index of the source node
+//				const char *name; name of the source node, not terminated
+//				size_t length; length of the name
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void BinaryResultWriter::beginSource(int /* source */, const char * /* name */,
+	size_t /* length */)
+{
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void BinaryResultWriter::pathRow(int source, int destination,
+//					int dist, const vector<int> &nodes)
+// Title:		Writes one record
+// Description: Writes source, destination, dist, node count and nodes
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int source; array index of the source node
+//				int destination; array index of the destination node
+//				int dist; lowest cost, INT_MAX if no path exists
+//				const vector<int> &nodes; the path, source first
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void BinaryResultWriter::pathRow(int source, int destination, int dist,
+	const vector<int> &nodes)
+{
+	appendInt(source);
+	appendInt(destination);
+	appendInt(dist);
+	appendInt((int)nodes.size());
+	if (!nodes.empty())
+	{
+		buffer.append((const char *)&nodes[0], nodes.size() * sizeof(int32_t));
+	}
+	spill();
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void BinaryResultWriter::endSource(int source)
+// Title:		Ends a source
+// Description: Nothing to write
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int source; array index of the source node
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void BinaryResultWriter::endSource(int /* source */)
+{
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void BinaryResultWriter::appendInt(int value)
+// Title:		Appends an integer
+// Description: Appends value as 4 bytes in machine byte order
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int value; value to append
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void BinaryResultWriter::appendInt(int value)
+{
+	int32_t word = value;
+	buffer.append((const char *)&word, sizeof(word));
+}
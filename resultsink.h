@@ -0,0 +1,98 @@
+#ifndef RESULTSINK_H
+#define RESULTSINK_H
+//----------------------------------------------------------------------------
+// File: resultsink.h
+//
+// Description: Function outlines for the ResultSink interface, which
+//				receives shortest path results one row at a time, and its
+//				writers. Writers collect output in a buffer, hand it to the
+//				stream in large blocks and flush only once at the end
+//
+// Programmer:	Anthony Waddell
+//
+// Environment: Hardware: PC, i7
+//              Software: OS: Windows 10
+//              Compiles under Microsoft Visual C++ 2015, g++
+//-----------------------------------------------------------------------------
+#include <iostream>
+#include <limits.h>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// Receives results in source order, dist is INT_MAX when no path exists
+class ResultSink
+{
+public:
+	virtual ~ResultSink();
+
+	virtual void beginSource(int source, const char *name,
+		size_t length) = 0;
+	virtual void pathRow(int source, int destination, int dist,
+		const vector<int> &nodes) = 0;
+	virtual void endSource(int source) = 0;
+	virtual void finish() = 0;
+};
+
+// Shared output buffer of the writers below
+class BufferedWriter : public ResultSink
+{
+public:
+	BufferedWriter(ostream &out);
+	virtual void finish();
+
+protected:
+	void spill();
+
+	static const size_t BLOCK = 1 << 20;  // bytes held before writing
+
+	ostream &out;                         // stream written to
+	string buffer;                        // output not yet written
+};
+
+// Text in the displayAll layout
+class TextResultWriter : public BufferedWriter
+{
+public:
+	TextResultWriter(ostream &out);
+
+	virtual void beginSource(int source, const char *name, size_t length);
+	virtual void pathRow(int source, int destination, int dist,
+		const vector<int> &nodes);
+	virtual void endSource(int source);
+
+private:
+	void appendField(const string &text, int width);
+	void appendField(int value, int width);
+};
+
+// One "source,destination,dist,path" line per row, path nodes separated by
+// spaces, dist and path empty when no path exists
+class CsvResultWriter : public BufferedWriter
+{
+public:
+	CsvResultWriter(ostream &out);
+
+	virtual void beginSource(int source, const char *name, size_t length);
+	virtual void pathRow(int source, int destination, int dist,
+		const vector<int> &nodes);
+	virtual void endSource(int source);
+};
+
+// One record per row of int32 source, destination, dist, node count and
+// nodes, in the byte order of the machine. out must be opened binary
+class BinaryResultWriter : public BufferedWriter
+{
+public:
+	BinaryResultWriter(ostream &out);
+
+	virtual void beginSource(int source, const char *name, size_t length);
+	virtual void pathRow(int source, int destination, int dist,
+		const vector<int> &nodes);
+	virtual void endSource(int source);
+
+private:
+	void appendInt(int value);
+};
+#endif
\ No newline at end of file
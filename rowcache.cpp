@@ -0,0 +1,226 @@
+//-----------------------------------------------------------------------------
+// File:		rowcache.cpp
+// Programmer:	Anthony Waddell
+// Resources:	https://en.wikipedia.org/wiki/Page_replacement_algorithm#Clock
+//-----------------------------------------------------------------------------
+#include "rowcache.h"
+#include <string.h>
+
+//-----------------------------------------------------------------------------
+// Function:	RowCache::RowCache()
+// Title:		Constructor
+// Description: Constructs a cache that is off until given a capacity
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		N/A
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+RowCache::RowCache()
+{
+	capacity = 0;
+	hand = 0;
+	memset(&counters, 0, sizeof(counters));
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void RowCache::setCapacity(size_t bytes)
+// Title:		Sizes the cache
+// Description: Drops every row, zeroes the counters and sets the most bytes
+//					the rows may take. Each row of a graph of n nodes takes
+//					about 8 (n + 1) bytes
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	size_t bytes; byte budget, 0 to turn the cache off
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void RowCache::setCapacity(size_t bytes)
+{
+	capacity = bytes;
+	vector<CachedRow>().swap(slots);
+	slotOf.clear();
+	hand = 0;
+	memset(&counters, 0, sizeof(counters));
+}
+
+//-----------------------------------------------------------------------------
+// Function:	bool RowCache::enabled() const
+// Title:		Cache in use
+// Description: Returns whether the cache has a byte budget
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		bool; true if rows are cached
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+bool RowCache::enabled() const
+{
+	return capacity > 0;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	const CachedRow *RowCache::find(int source)
+// Title:		Looks up a row
+// Description: Returns the row of source and marks it used, so the clock
+//					passes it over once, counting a hit. Counts a miss when
+//					source has no row
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int source; array index of the source node
+// Returns:		const CachedRow *; row of source, NULL if not cached. Valid
+//					until the next insert or invalidate
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+const CachedRow *RowCache::find(int source)
+{
+	if (source >= 0 && source < (int)slotOf.size() && slotOf[source] >= 0)
+	{
+		CachedRow &row = slots[slotOf[source]];
+		row.referenced = true;
+		counters.hits++;
+		return &row;
+	}
+	counters.misses++;
+	return NULL;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	const CachedRow *RowCache::insert(int source,
+//					const vector<int> &dist, const vector<int> &path)
+// Title:		Adds a row
+// Description: Copies the search result of source into a new slot while
+//					the budget allows one more row, and otherwise into the
+//					slot of the first row the clock hand reaches that was
+//					not used since it last passed, clearing the used mark of
+//					rows it passes over. A new row starts unused, so a
+//					source searched once is the first to go
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	int source; array index of the source node
+//				const vector<int> &dist; lowest cost of each node
+//				const vector<int> &path; previous node of each node
+// Returns:		const CachedRow *; the new row, NULL if the cache is off
+//					or a row does not fit in it. Valid until the next
+//					insert or invalidate
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+const CachedRow *RowCache::insert(int source, const vector<int> &dist,
+	const vector<int> &path)
+{
+	size_t need = rowBytes(dist.size());
+	if (source < 0 || need > capacity)
+	{
+		return NULL;
+	}
+	if (source < (int)slotOf.size() && slotOf[source] >= 0)
+	{
+		CachedRow &row = slots[slotOf[source]];
+		row.dist = dist;
+		row.path = path;
+		return &row;
+	}
+
+	size_t slot = 0;
+	if ((slots.size() + 1) * need <= capacity)
+	{
+		slot = slots.size();
+		slots.push_back(CachedRow());
+	}
+	else
+	{
+		// Second chance, clear used marks until an unused row comes round
+		while (slots[hand].referenced)
+		{
+			slots[hand].referenced = false;
+			hand = (hand + 1) % slots.size();
+		}
+		slot = hand;
+		hand = (hand + 1) % slots.size();
+		slotOf[slots[slot].source] = -1;
+		counters.evictions++;
+	}
+
+	if (source >= (int)slotOf.size())
+	{
+		slotOf.resize(source + 1, -1);
+	}
+	CachedRow &row = slots[slot];
+	row.source = source;
+	row.referenced = false;
+	row.dist = dist;
+	row.path = path;
+	slotOf[source] = (int)slot;
+	return &row;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void RowCache::invalidate()
+// Title:		Drops every row
+// Description: Drops every row, called whenever an edge changes since any
+//					row may then be wrong. Counted when there were rows
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void RowCache::invalidate()
+{
+	if (slots.empty())
+	{
+		return;
+	}
+	for (size_t i = 0; i < slots.size(); i++)
+	{
+		slotOf[slots[i].source] = -1;
+	}
+	slots.clear();
+	hand = 0;
+	counters.invalidations++;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	RowCacheStats RowCache::stats() const
+// Title:		Cache counters
+// Description: Returns the hit, miss, eviction and invalidation counts
+//					since the cache was sized, and the rows held now. The
+//					hit rate is hits / (hits + misses)
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		RowCacheStats; counters and current size
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+RowCacheStats RowCache::stats() const
+{
+	RowCacheStats result = counters;
+	result.rows = slots.size();
+	result.bytes = slots.empty() ? 0
+		: slots.size() * rowBytes(slots[0].dist.size());
+	return result;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	size_t RowCache::rowBytes(size_t length) const
+// Title:		Size of a row
+// Description: Returns the bytes a row of length costs and previous nodes
+//					takes, counting its slot
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	size_t length; entries in the row
+// Returns:		size_t; bytes of the row
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+size_t RowCache::rowBytes(size_t length) const
+{
+	return sizeof(CachedRow) + 2 * length * sizeof(int);
+}
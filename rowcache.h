@@ -0,0 +1,76 @@
+#ifndef ROWCACHE_H
+#define ROWCACHE_H
+//----------------------------------------------------------------------------
+// File: rowcache.h
+//
+// Description: Function outlines for the RowCache class, a cache of single
+//				source results kept in front of the search so sources that
+//				are queried again are answered without searching. Rows are
+//				held up to a byte budget and evicted in CLOCK order: a row
+//				used since the hand last passed it gets a second chance,
+//				so hot sources stay while sources used once cycle out
+//
+// Programmer:	Anthony Waddell
+//
+// Environment: Hardware: PC, i7
+//              Software: OS: Windows 10
+//              Compiles under Microsoft Visual C++ 2015, g++
+//-----------------------------------------------------------------------------
+#include <stddef.h>
+#include <vector>
+
+using namespace std;
+
+// Costs and previous nodes from one source, as DijkstraEngine::run gives
+struct CachedRow
+{
+	int source;                // node the row was searched from, 0 if free
+	bool referenced;           // used since the clock hand last passed
+	vector<int> dist;          // lowest cost of each node, INT_MAX if none
+	vector<int> path;          // previous node on the lowest cost path
+};
+
+// Counters since the cache was last sized
+struct RowCacheStats
+{
+	long long hits;            // lookups answered from a row
+	long long misses;          // lookups that had to search
+	long long evictions;       // rows dropped to make room
+	long long invalidations;   // times every row was dropped
+	size_t rows;               // rows held now
+	size_t bytes;              // bytes of the rows held now
+};
+
+class RowCache
+{
+public:
+	// Constructor
+	RowCache();
+
+	// Byte budget of the rows, 0 turns the cache off
+	void setCapacity(size_t bytes);
+	bool enabled() const;
+
+	// Row of source marked as used, or NULL after counting a miss
+	const CachedRow *find(int source);
+
+	// Copy a search result in, evicting rows until it fits
+	const CachedRow *insert(int source, const vector<int> &dist,
+		const vector<int> &path);
+
+	// Drop every row after the graph changed
+	void invalidate();
+
+	RowCacheStats stats() const;
+
+private:
+
+	size_t rowBytes(size_t length) const;
+
+	size_t capacity;                      // byte budget, 0 if off
+	vector<CachedRow> slots;              // rows, in clock order
+	vector<int> slotOf;                   // slot of each source, -1 if none
+	size_t hand;                          // next slot the clock looks at
+	RowCacheStats counters;               // hits, misses, evictions
+};
+#endif
@@ -0,0 +1,105 @@
+//-----------------------------------------------------------------------------
+// File:		searchstats.cpp
+// Programmer:	Anthony Waddell
+// Resources:	N/A
+//-----------------------------------------------------------------------------
+#include "searchstats.h"
+#include <iomanip>
+#include <string.h>
+
+//-----------------------------------------------------------------------------
+// Function:	void SearchCounters::add(const SearchCounters &other)
+// Title:		Adds counters
+// Description: Adds the counts of other, used to merge the counters of
+//					each thread's search once it has finished
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	const SearchCounters &other; counters to add
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void SearchCounters::add(const SearchCounters &other)
+{
+	settled += other.settled;
+	relaxed += other.relaxed;
+	decreased += other.decreased;
+	pushes += other.pushes;
+	pops += other.pops;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void clearStats(SearchStats &stats)
+// Title:		Zeroes a snapshot
+// Description: Sets every counter, time and call count of stats to zero
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	SearchStats &stats; snapshot to clear
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void clearStats(SearchStats &stats)
+{
+	memset(&stats, 0, sizeof(stats));
+}
+
+//-----------------------------------------------------------------------------
+// Function:	const char *phaseName(SearchPhase phase)
+// Title:		Name of a phase
+// Description: Returns the name printStats shows for phase
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	SearchPhase phase; phase to name
+// Returns:		const char *; lower case name, "unknown" if out of range
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+const char *phaseName(SearchPhase phase)
+{
+	static const char *const NAMES[PHASE_COUNT] = { "parse", "build",
+		"solve", "query", "output" };
+	if (phase < 0 || phase >= PHASE_COUNT)
+	{
+		return "unknown";
+	}
+	return NAMES[phase];
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void printStats(ostream &out, const SearchStats &stats)
+// Title:		Prints a snapshot
+// Description: Prints one line per phase with its calls, total and mean
+//					seconds and the seconds of its latest call, then one line
+//					per counter
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	ostream &out; stream to print to
+//				const SearchStats &stats; snapshot to print
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void printStats(ostream &out, const SearchStats &stats)
+{
+	ios::fmtflags flags = out.flags();
+	streamsize precision = out.precision();
+	out << setw(8) << "phase" << setw(10) << "calls" << setw(14) << "seconds"
+		<< setw(14) << "mean" << setw(14) << "last" << endl;
+	out << fixed << setprecision(6);
+	for (int i = 0; i < PHASE_COUNT; i++)
+	{
+		double mean = stats.calls[i] > 0 ? stats.seconds[i] / stats.calls[i]
+			: 0;
+		out << setw(8) << phaseName((SearchPhase)i) << setw(10)
+			<< stats.calls[i] << setw(14) << stats.seconds[i] << setw(14)
+			<< mean << setw(14) << stats.lastSeconds[i] << endl;
+	}
+	out << "settled   " << stats.counters.settled << endl;
+	out << "relaxed   " << stats.counters.relaxed << endl;
+	out << "decreased " << stats.counters.decreased << endl;
+	out << "pushes    " << stats.counters.pushes << endl;
+	out << "pops      " << stats.counters.pops << endl;
+	out.flags(flags);
+	out.precision(precision);
+}
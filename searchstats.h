@@ -0,0 +1,102 @@
+#ifndef SEARCHSTATS_H
+#define SEARCHSTATS_H
+//----------------------------------------------------------------------------
+// File: searchstats.h
+//
+// Description: Counters of the work done by the shortest path searches and
+//				timers of the phases of GraphM, read as a snapshot so the
+//				time of a run or a single query can be put down to parsing,
+//				building, solving, querying or output. Compiling with
+//				DIJKSTRA_NO_STATS defined removes every counter update and
+//				timer, leaving the snapshot all zeros
+//
+// Programmer:	Anthony Waddell
+//
+// Environment: Hardware: PC, i7
+//              Software: OS: Windows 10
+//              Compiles under Microsoft Visual C++ 2015, g++
+//-----------------------------------------------------------------------------
+#include <chrono>
+#include <iostream>
+
+using namespace std;
+
+// Counter update in a search loop, nothing when stats are compiled out
+#ifndef DIJKSTRA_NO_STATS
+#define SEARCH_COUNT(statement) statement
+#else
+#define SEARCH_COUNT(statement)
+#endif
+
+// Work done by heap based searches
+struct SearchCounters
+{
+	long long settled;         // vertices popped with their final cost
+	long long relaxed;         // edges looked at from settled vertices
+	long long decreased;       // relaxations that lowered a cost
+	long long pushes;          // heap insertions
+	long long pops;            // heap removals, stale entries included
+
+	void add(const SearchCounters &other);
+};
+
+// Timed phases of GraphM
+enum SearchPhase
+{
+	PHASE_PARSE,               // reading the data file
+	PHASE_BUILD,               // building the packed edges and name index
+	PHASE_SOLVE,               // filling table rows
+	PHASE_QUERY,               // point to point queries
+	PHASE_OUTPUT,              // paths and names written out
+	PHASE_COUNT
+};
+
+// Snapshot of the counters and phase times
+struct SearchStats
+{
+	SearchCounters counters;          // work of every search
+	double seconds[PHASE_COUNT];      // total time in each phase
+	double lastSeconds[PHASE_COUNT];  // time of the latest call of each phase
+	long long calls[PHASE_COUNT];     // times each phase was entered
+};
+
+// Zero a snapshot and print one, a line per phase then the counters
+void clearStats(SearchStats &stats);
+void printStats(ostream &out, const SearchStats &stats);
+const char *phaseName(SearchPhase phase);
+
+// Times the enclosing block and adds it to one phase of stats
+class PhaseTimer
+{
+public:
+#ifndef DIJKSTRA_NO_STATS
+	PhaseTimer(SearchStats &stats, SearchPhase phase)
+		: stats(stats), phase(phase), start(chrono::steady_clock::now())
+	{
+	}
+
+	~PhaseTimer()
+	{
+		double elapsed = chrono::duration<double>(
+			chrono::steady_clock::now() - start).count();
+		stats.seconds[phase] += elapsed;
+		stats.lastSeconds[phase] = elapsed;
+		stats.calls[phase]++;
+	}
+
+private:
+
+	// Not copyable, each timer covers one block
+	PhaseTimer(const PhaseTimer &);
+	PhaseTimer& operator=(const PhaseTimer &);
+
+	SearchStats &stats;                   // snapshot the time is added to
+	SearchPhase phase;                    // phase being timed
+	chrono::steady_clock::time_point start;  // when the block was entered
+#else
+	PhaseTimer(SearchStats &, SearchPhase)
+	{
+	}
+#endif
+};
+#endif
@@ -0,0 +1,325 @@
+//-----------------------------------------------------------------------------
+// File:		tablefile.cpp
+// Programmer:	Anthony Waddell
+// Resources:	N/A
+//-----------------------------------------------------------------------------
+#include "tablefile.h"
+#include <fstream>
+#include <string.h>
+
+//-----------------------------------------------------------------------------
+// Function:	TableFile::TableFile()
+// Title:		Constructor
+// Description: Constructs a closed table file
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		N/A
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+TableFile::TableFile()
+{
+	base = NULL;
+	header = NULL;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	bool TableFile::write(const string &fileName,
+//					uint64_t graphHash, const DistanceTable &table,
+//					const vector<uint8_t> &solved)
+// Title:		Writes a table file
+// Description: Lays out the header, solved rows, costs and previous node
+//					rows of table and writes them to fileName. A loaded
+//					table is read from a mapping of its file, so the file
+//					is written under a temporary name and moved over it
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	const string &fileName; file to create or replace
+//				uint64_t graphHash; hash of the graph table was solved for
+//				const DistanceTable &table; table to write
+//				const vector<uint8_t> &solved; rows holding results
+// Returns:		bool; true if the whole file was written
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Solved flags stored a byte each
+//				10/17/26 AW Writes a temporary file and renames it
+//-----------------------------------------------------------------------------
+bool TableFile::write(const string &fileName, uint64_t graphHash,
+	const DistanceTable &table, const vector<uint8_t> &solved)
+{
+	uint32_t nodes = (uint32_t)table.nodeCount();
+	if (table.empty() || solved.size() < nodes + 1)
+	{
+		return false;
+	}
+
+	// One byte per solved flag and the list of rows keeping previous nodes
+	vector<uint8_t> solvedBytes(nodes + 1, 0);
+	vector<int32_t> pathRows;
+	for (uint32_t row = 0; row <= nodes; row++)
+	{
+		solvedBytes[row] = solved[row] ? 1 : 0;
+		if (table.hasPaths(row))
+		{
+			pathRows.push_back((int32_t)row);
+		}
+	}
+	uint64_t cells = (uint64_t)(nodes + 1) * (nodes + 1);
+	uint64_t rowBytes = (uint64_t)(nodes + 1) * sizeof(int32_t);
+
+	TableFileHeader header;
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, "DJKTABLE", 8);
+	header.version = TABLE_FILE_VERSION;
+	header.byteOrder = 0x01020304;
+	header.nodes = nodes;
+	header.costBytes = table.isWide() ? 4 : 2;
+	header.graphHash = graphHash;
+	header.pathRows = (uint32_t)pathRows.size();
+	header.solvedStart = MappedFile::alignUp(sizeof(TableFileHeader));
+	header.costStart = MappedFile::alignUp(header.solvedStart + nodes + 1);
+	header.pathRowStart = MappedFile::alignUp(header.costStart
+		+ cells * header.costBytes);
+	header.pathStart = MappedFile::alignUp(header.pathRowStart
+		+ pathRows.size() * sizeof(int32_t));
+	header.fileBytes = header.pathStart + pathRows.size() * rowBytes;
+
+	string tempName = MappedFile::tempName(fileName);
+	ofstream out(tempName.c_str(), ios::binary | ios::trunc);
+	if (!out)
+	{
+		return false;
+	}
+	out.write((const char *)&header, sizeof(header));
+	MappedFile::writeSection(out, header.solvedStart, &solvedBytes[0],
+		solvedBytes.size());
+	MappedFile::writeSection(out, header.costStart, table.costArray(),
+		(size_t)(cells * header.costBytes));
+	MappedFile::writeSection(out, header.pathRowStart,
+		pathRows.empty() ? NULL : &pathRows[0],
+		pathRows.size() * sizeof(int32_t));
+	for (size_t i = 0; i < pathRows.size(); i++)
+	{
+		MappedFile::writeSection(out, header.pathStart + i * rowBytes,
+			table.pathArray(pathRows[i]), (size_t)rowBytes);
+	}
+	return MappedFile::replaceFile(out, tempName, fileName);
+}
+
+//-----------------------------------------------------------------------------
+// Function:	bool TableFile::open(const string &fileName)
+// Title:		Opens a table file
+// Description: Maps fileName read only and checks its header, section
+//					layout and previous nodes. Nothing is copied, only the
+//					path rows are read through once
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	const string &fileName; file to open
+// Returns:		bool; true if the file is a valid table file
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Previous nodes checked too
+//-----------------------------------------------------------------------------
+bool TableFile::open(const string &fileName)
+{
+	close();
+	if (!file.open(fileName))
+	{
+		return false;
+	}
+	base = file.data();
+	header = (const TableFileHeader *)base;
+	if (file.size() < sizeof(TableFileHeader) || !validate())
+	{
+		close();
+		return false;
+	}
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	bool TableFile::validate() const
+// Title:		Checks the file layout
+// Description: Checks magic, version, byte order and cost width, that every
+//					section lies inside the file on an 8 byte boundary, and
+//					that each listed path row is a node, listed once and in
+//					increasing order. Every previous node must be 0 or a
+//					node of the graph, since paths and repairs index by it.
+//					Costs are not scanned, any value is safe to read
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		bool; true if the layout is valid
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Checks previous nodes
+//-----------------------------------------------------------------------------
+bool TableFile::validate() const
+{
+	const TableFileHeader &h = *header;
+	size_t length = file.size();
+	if (memcmp(h.magic, "DJKTABLE", 8) != 0 || h.version != TABLE_FILE_VERSION
+		|| h.byteOrder != 0x01020304 || h.fileBytes != length
+		|| (h.costBytes != 2 && h.costBytes != 4)
+		|| h.nodes >= (1u << 20) || h.pathRows > h.nodes)
+	{
+		return false;
+	}
+
+	// Each section in order, aligned, and long enough for its contents
+	uint64_t cells = (uint64_t)(h.nodes + 1) * (h.nodes + 1);
+	uint64_t starts[4] = { h.solvedStart, h.costStart, h.pathRowStart,
+		h.pathStart };
+	uint64_t bytes[4] = { (uint64_t)h.nodes + 1, cells * h.costBytes,
+		(uint64_t)h.pathRows * sizeof(int32_t),
+		(uint64_t)h.pathRows * (h.nodes + 1) * sizeof(int32_t) };
+	uint64_t end = sizeof(TableFileHeader);
+	for (int i = 0; i < 4; i++)
+	{
+		if (starts[i] % 8 != 0 || starts[i] < end || bytes[i] > length
+			|| starts[i] > length - bytes[i])
+		{
+			return false;
+		}
+		end = starts[i] + bytes[i];
+	}
+
+	const int32_t *pathRows = (const int32_t *)(base + h.pathRowStart);
+	for (uint32_t i = 0; i < h.pathRows; i++)
+	{
+		if (pathRows[i] < 1 || pathRows[i] > (int32_t)h.nodes
+			|| (i > 0 && pathRows[i] <= pathRows[i - 1]))
+		{
+			return false;
+		}
+	}
+
+	// Previous nodes are 0 for none or nodes 1 to nodes
+	const int32_t *paths = (const int32_t *)(base + h.pathStart);
+	uint64_t pathCells = (uint64_t)h.pathRows * (h.nodes + 1);
+	for (uint64_t i = 0; i < pathCells; i++)
+	{
+		if (paths[i] < 0 || paths[i] > (int32_t)h.nodes)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void TableFile::close()
+// Title:		Closes the file
+// Description: Releases the mapping. Tables attached to the file must not
+//					be used after this unless they have been changed, which
+//					copies them out of it
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void TableFile::close()
+{
+	file.close();
+	base = NULL;
+	header = NULL;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	bool TableFile::isOpen() const
+// Title:		Checks for an open file
+// Description: Returns whether a valid file is open
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		bool; true if open
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+bool TableFile::isOpen() const
+{
+	return header != NULL;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	int TableFile::nodeCount() const
+// Title:		Number of nodes
+// Description: Returns the number of nodes of the table in the open file
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		int; number of nodes, 0 if not open
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+int TableFile::nodeCount() const
+{
+	return header == NULL ? 0 : (int)header->nodes;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	uint64_t TableFile::graphHash() const
+// Title:		Hash of the solved graph
+// Description: Returns the graph hash recorded when the file was written
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	N/A
+// Returns:		uint64_t; graph hash, 0 if not open
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+uint64_t TableFile::graphHash() const
+{
+	return header == NULL ? 0 : header->graphHash;
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void TableFile::attach(DistanceTable &table) const
+// Title:		Attaches the table
+// Description: Makes table read the costs and previous node rows in place
+//					in the file
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	DistanceTable &table; table to attach, valid while file is
+//					open
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//-----------------------------------------------------------------------------
+void TableFile::attach(DistanceTable &table) const
+{
+	table.attach((int)header->nodes, header->costBytes == 4,
+		base + header->costStart);
+	const int32_t *pathRows = (const int32_t *)(base + header->pathRowStart);
+	const int32_t *paths = (const int32_t *)(base + header->pathStart);
+	for (uint32_t i = 0; i < header->pathRows; i++)
+	{
+		table.attachPaths(pathRows[i],
+			paths + (size_t)i * (header->nodes + 1));
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Function:	void TableFile::solvedRows(vector<uint8_t> &solved) const
+// Title:		Solved rows
+// Description: Reads which rows of the table in the file hold results
+//
+// Programmer:	Anthony Waddell
+//
+// Parameters:	vector<uint8_t> &solved; set to nodes + 1 solved flags
+// Returns:		void
+// History Log: 10/17/26 AW Completed Function
+//				10/17/26 AW Solved flags stored a byte each
+//-----------------------------------------------------------------------------
+void TableFile::solvedRows(vector<uint8_t> &solved) const
+{
+	const uint8_t *flags = (const uint8_t *)(base + header->solvedStart);
+	solved.assign(header->nodes + 1, false);
+	for (uint32_t row = 0; row <= header->nodes; row++)
+	{
+		solved[row] = flags[row] != 0;
+	}
+}
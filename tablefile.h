@@ -0,0 +1,89 @@
+#ifndef TABLEFILE_H
+#define TABLEFILE_H
+//----------------------------------------------------------------------------
+// File: tablefile.h
+//
+// Description: Function outlines for the TableFile class, a solved distance
+//				table saved to a file that is mapped into memory and read in
+//				place, so solved results outlive the process. A file is a
+//				TableFileHeader followed by the sections it locates, each
+//				starting on an 8 byte boundary:
+//					solved		uint8[nodes + 1], 1 for each solved row
+//					costs		uint16 or int32[(nodes + 1)^2], the
+//								DistanceTable costs in row order
+//					path rows	int32[pathRows], rows keeping previous nodes
+//					paths		int32[pathRows][nodes + 1], their previous
+//								nodes in the order of path rows
+//				The header records a hash of the edges the table was solved
+//				for, so a table is only used with the graph it belongs to.
+//				Integers are in the byte order of the machine that wrote
+//				the file, which the header records
+//
+// Programmer:	Anthony Waddell
+//
+// Environment: Hardware: PC, i7
+//              Software: OS: Windows 10
+//              Compiles under Microsoft Visual C++ 2015, g++
+//-----------------------------------------------------------------------------
+#include "distancetable.h"
+#include "mappedfile.h"
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+const uint32_t TABLE_FILE_VERSION = 1;
+
+// Fixed size start of a table file
+struct TableFileHeader
+{
+	char magic[8];             // "DJKTABLE"
+	uint32_t version;          // TABLE_FILE_VERSION of the writer
+	uint32_t byteOrder;        // 0x01020304 as stored by the writer
+	uint32_t nodes;            // number of nodes, index 0 not being used
+	uint32_t costBytes;        // 2 or 4
+	uint64_t graphHash;        // GraphM::graphHash of the solved graph
+	uint32_t pathRows;         // rows keeping previous nodes
+	uint32_t reserved;         // 0
+	uint64_t solvedStart;      // file position of each section
+	uint64_t costStart;
+	uint64_t pathRowStart;
+	uint64_t pathStart;
+	uint64_t fileBytes;        // total length of the file
+};
+
+class TableFile
+{
+public:
+	// Constructor
+	TableFile();
+
+	// Write a table, its solved rows and the hash of its graph
+	static bool write(const string &fileName, uint64_t graphHash,
+		const DistanceTable &table, const vector<uint8_t> &solved);
+
+	// Map a file and check its header, close releases the mapping
+	bool open(const string &fileName);
+	void close();
+	bool isOpen() const;
+
+	// Contents of the open file, used in place
+	int nodeCount() const;
+	uint64_t graphHash() const;
+	void attach(DistanceTable &table) const;
+	void solvedRows(vector<uint8_t> &solved) const;
+
+private:
+
+	// Not copyable, the mapping has one owner
+	TableFile(const TableFile &);
+	TableFile& operator=(const TableFile &);
+
+	bool validate() const;
+
+	MappedFile file;                      // file contents in memory
+	const char *base;                     // start of file, NULL if not open
+	const TableFileHeader *header;        // header at base
+};
+#endif